@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <vector>
@@ -5,12 +6,14 @@
 #include "uranium/core/AppEntry.hpp"
 #include "uranium/core/Logger.hpp"
 #include "uranium/event/EventDispatcher.hpp"  // FOR TEST
+#include "uranium/platform/headless/HeadlessApp.hpp"
 #include "uranium/platform/windows/OpenGLApp.hpp"
 
 using namespace std::chrono;
 using namespace uranium::event;
 
 using namespace uranium::core;
+using namespace uranium::platform::headless;
 using namespace uranium::platform::windows;
 
 void test_EventManager() {
@@ -19,9 +22,11 @@ void test_EventManager() {
   };
 }
 
-class MyApplication final : public OpenGLApp {
+// The same game runs on a window system or headless (--headless)
+template <typename Platform>
+class MyApplication final : public Platform {
 public:
-  MyApplication() noexcept : OpenGLApp() {
+  MyApplication() noexcept : Platform() {
     std::cout << "MyApplication initialized" << std::endl;
 
     test_EventManager();
@@ -34,5 +39,8 @@ public:
 
 std::unique_ptr<uranium::core::IApp> uranium::core::launchApp(
     std::vector<std::string>& args) {
-  return std::make_unique<MyApplication>();
+  if (std::ranges::find(args, "--headless") != args.end()) {
+    return std::make_unique<MyApplication<HeadlessApp>>();
+  }
+  return std::make_unique<MyApplication<OpenGLApp>>();
 }
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include "Bench.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <format>
+#include <print>
+#include <string>
+
+using namespace uranium::bench;
+
+/**
+ * @struct Entry
+ * @brief A registered benchmark.
+ */
+struct Entry {
+  std::string_view name;
+  Function function;
+  uint32_t batch;
+};
+
+/**
+ * @struct Report
+ * @brief Statistics of a run, in ns per operation.
+ */
+struct Report {
+  std::string_view name;
+  uint32_t batch;
+  size_t repetitions;
+  double min, mean, p50, p90, p99, max;
+};
+
+/**
+ * @struct Options
+ * @brief Command line of the runner.
+ */
+struct Options {
+  std::string_view filter;
+  std::string_view json;
+  uint32_t warmup = 3;
+  uint32_t repetitions = 30;
+};
+
+static std::vector<Entry>& registry() {
+  // Function local, benchmarks enroll during static initialisation
+  static std::vector<Entry> entries;
+  return entries;
+}
+
+static double percentile(const std::vector<double>& sorted, double rank) {
+  // Nearest rank on the sorted samples
+  size_t index = static_cast<size_t>(rank * (sorted.size() - 1) + 0.5);
+  return sorted[std::min(index, sorted.size() - 1)];
+}
+
+static Report summarize(const Entry& entry, std::vector<double> samples) {
+  std::sort(samples.begin(), samples.end());
+
+  double sum = 0.0;
+  for (double sample : samples) {
+    sum += sample;
+  }
+
+  return Report{entry.name,
+                entry.batch,
+                samples.size(),
+                samples.front(),
+                sum / samples.size(),
+                percentile(samples, 0.50),
+                percentile(samples, 0.90),
+                percentile(samples, 0.99),
+                samples.back()};
+}
+
+static bool writeJson(std::string_view path,
+                      const std::vector<Report>& reports) {
+  std::FILE* file = std::fopen(std::string(path).c_str(), "w");
+  if (!file) {
+    std::println("Cannot write {}", path);
+    return false;
+  }
+
+  std::string json = "{\n  \"benchmarks\": [\n";
+  for (size_t i = 0; i < reports.size(); ++i) {
+    const Report& r = reports[i];
+    json += std::format(
+        "    {{\"name\": \"{}\", \"batch\": {}, \"repetitions\": {}, "
+        "\"ns_per_op\": {{\"min\": {:.3f}, \"mean\": {:.3f}, "
+        "\"p50\": {:.3f}, \"p90\": {:.3f}, \"p99\": {:.3f}, "
+        "\"max\": {:.3f}}}, "
+        "\"ops_per_sec\": {:.0f}}}{}\n",
+        r.name, r.batch, r.repetitions, r.min, r.mean, r.p50, r.p90, r.p99,
+        r.max, 1e9 / r.p50, i + 1 < reports.size() ? "," : "");
+  }
+  json += "  ]\n}\n";
+
+  std::fwrite(json.data(), 1, json.size(), file);
+  std::fclose(file);
+  return true;
+}
+
+static bool parseCount(std::string_view text, uint32_t& out,
+                       uint32_t min) {
+  const char* last = text.data() + text.size();
+  auto [end, error] = std::from_chars(text.data(), last, out);
+  return error == std::errc() && end == last && out >= min;
+}
+
+static bool parse(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; ++i) {
+    std::string_view arg = argv[i];
+    std::string_view value = i + 1 < argc ? argv[i + 1] : "";
+
+    bool valid = true;
+    if (arg == "--filter") {
+      options.filter = value;
+    } else if (arg == "--json") {
+      options.json = value;
+    } else if (arg == "--warmup") {
+      valid = parseCount(value, options.warmup, 0);  // No warmup is fine
+    } else if (arg == "--repetitions") {
+      valid = parseCount(value, options.repetitions, 1);
+    } else {
+      valid = false;
+    }
+
+    if (!valid || value.empty()) {
+      std::println(
+          "usage: uranium_bench [--filter text] [--warmup n] "
+          "[--repetitions n] [--json file]");
+      return false;
+    }
+    ++i;
+  }
+  return true;
+}
+
+State::State(uint32_t warmup, uint32_t repetitions, uint32_t batch) noexcept
+    : warmup(warmup),
+      repetitions(repetitions),
+      batch_size(batch),
+      iteration(0),
+      started(),
+      elapsed(0),
+      measured() {
+  measured.reserve(repetitions);
+}
+
+bool State::next() {
+  Clock::time_point now = Clock::now();
+
+  // Close the iteration that just ran
+  if (iteration > warmup) {
+    elapsed += now - started;
+    double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+    measured.push_back(ns / batch_size);
+  }
+  if (iteration == warmup + repetitions) {
+    return false;
+  }
+
+  ++iteration;
+  elapsed = Clock::duration(0);
+  started = Clock::now();
+  return true;
+}
+
+uint32_t State::batch() const noexcept { return batch_size; }
+
+void State::pause() noexcept { elapsed += Clock::now() - started; }
+
+void State::resume() noexcept { started = Clock::now(); }
+
+const std::vector<double>& State::samples() const noexcept {
+  return measured;
+}
+
+bool uranium::bench::enroll(std::string_view name, Function function,
+                            uint32_t batch) {
+  registry().push_back(Entry{name, function, batch});
+  return true;
+}
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parse(argc, argv, options)) {
+    return 1;
+  }
+
+  std::vector<Entry> entries = registry();
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) { return a.name < b.name; });
+
+  std::println("{:<40} {:>10} {:>10} {:>10} {:>14}", "benchmark", "p50 ns",
+               "p90 ns", "p99 ns", "ops/s");
+
+  std::vector<Report> reports;
+  for (const Entry& entry : entries) {
+    if (entry.name.find(options.filter) == std::string_view::npos) {
+      continue;
+    }
+
+    State state(options.warmup, options.repetitions, entry.batch);
+    entry.function(state);
+    if (state.samples().empty()) {
+      std::println("{:<40} did not run", entry.name);
+      continue;
+    }
+
+    Report report = summarize(entry, state.samples());
+    std::println("{:<40} {:>10.2f} {:>10.2f} {:>10.2f} {:>14.0f}",
+                 report.name, report.p50, report.p90, report.p99,
+                 1e9 / report.p50);
+    reports.push_back(report);
+  }
+
+  if (!options.json.empty() && !writeJson(options.json, reports)) {
+    return 1;
+  }
+  return 0;
+}
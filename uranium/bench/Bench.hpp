@@ -0,0 +1,116 @@
+/*******************************************************************
+ * @file   Bench.hpp
+ * @brief  Minimal micro-benchmark harness of the uranium_bench target.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <chrono>
+#include <string_view>
+#include <vector>
+
+#include "uranium/core/Types.hpp"
+
+namespace uranium::bench {
+
+  /**
+   * @class State
+   * @brief Drives the repetitions of one benchmark and times them.
+   *
+   *        A benchmark sets up what it needs, then loops on next(), doing
+   *        batch() operations per iteration. The first iterations are
+   *        warmup and are not kept. Work between pause() and resume() is
+   *        not timed.
+   */
+  class State final {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+  public:
+    /**
+     * @brief Constructs the state of a run.
+     *
+     * @param warmup      Iterations run before measuring.
+     * @param repetitions Iterations measured.
+     * @param batch       Operations per iteration.
+     */
+    explicit State(uint32_t warmup, uint32_t repetitions,
+                   uint32_t batch) noexcept;
+
+    /**
+     * @brief Closes the timing of the previous iteration and opens the
+     *        next one.
+     *
+     * @return false once every repetition has been measured.
+     */
+    bool next();
+
+    /**
+     * @brief Operations expected per iteration.
+     */
+    uint32_t batch() const noexcept;
+
+    /**
+     * @brief Stops the clock of the current iteration.
+     */
+    void pause() noexcept;
+
+    /**
+     * @brief Restarts the clock of the current iteration.
+     */
+    void resume() noexcept;
+
+    /**
+     * @brief Time per operation of every measured iteration, in ns.
+     */
+    const std::vector<double>& samples() const noexcept;
+
+  private:
+    uint32_t warmup;
+    uint32_t repetitions;
+    uint32_t batch_size;
+    uint32_t iteration;
+
+    Clock::time_point started;
+    Clock::duration elapsed;
+    std::vector<double> measured;
+  };
+
+  /**
+   * @brief Signature of a benchmark.
+   */
+  using Function = void (*)(State& state);
+
+  /**
+   * @brief Adds a benchmark to the global registry.
+   *
+   * @param name     Unique name, used by --filter and in the report.
+   * @param function The benchmark.
+   * @param batch    Operations per iteration.
+   * @return Always true, so it can initialise a static.
+   */
+  bool enroll(std::string_view name, Function function, uint32_t batch);
+
+  /**
+   * @brief Keeps the compiler from optimizing a value away.
+   */
+  template <typename T>
+  inline void keep(const T& value) {
+    [[maybe_unused]] static thread_local const void* volatile sink;
+    sink = &value;
+  }
+}  // namespace uranium::bench
+
+/*
+ * @brief Defines a benchmark and registers it.
+ *
+ * @param name  - name of the benchmark function.
+ * @param batch - number of operations per iteration.
+ */
+#define UR_BENCHMARK(name, batch)                                      \
+  static void name(uranium::bench::State& state);                      \
+  static const bool name##_enrolled =                                  \
+      uranium::bench::enroll(#name, &name, batch);                     \
+  static void name(uranium::bench::State& state)
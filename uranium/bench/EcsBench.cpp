@@ -0,0 +1,106 @@
+#include <memory>
+#include <vector>
+
+#include "Bench.hpp"
+#include "uranium/ecs/Query.hpp"
+
+using namespace uranium::bench;
+using namespace uranium::ecs;
+
+struct Position {
+  float x, y, z;
+};
+
+struct Velocity {
+  float x, y, z;
+};
+
+struct Health {
+  float value;
+};
+
+static constexpr size_t ENTITIES = 100000;
+
+// Objects behind pointers, the layout an ECS replaces
+UR_BENCHMARK(Ecs_IntegrateObjects, 1) {
+  struct Object {
+    Position position;
+    Velocity velocity;
+    Health health;
+  };
+  std::vector<std::unique_ptr<Object>> objects;
+  for (size_t i = 0; i < ENTITIES; ++i) {
+    objects.push_back(std::make_unique<Object>(
+        Object{{0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}, {100.0f}}));
+  }
+  while (state.next()) {
+    for (auto& object : objects) {
+      object->position.x += object->velocity.x * 0.016f;
+      object->position.y += object->velocity.y * 0.016f;
+      object->position.z += object->velocity.z * 0.016f;
+    }
+    keep(objects.back()->position);
+  }
+}
+
+UR_BENCHMARK(Ecs_IntegrateChunks, 1) {
+  World world;
+  for (size_t i = 0; i < ENTITIES; ++i) {
+    world.create(Position{0.0f, 0.0f, 0.0f}, Velocity{1.0f, 2.0f, 3.0f},
+                 Health{100.0f});
+  }
+  Query<Position, const Velocity> query(world);
+  while (state.next()) {
+    query.eachChunk([](size_t count, const Entity*, Position* positions,
+                       const Velocity* velocities) {
+      for (size_t i = 0; i < count; ++i) {
+        positions[i].x += velocities[i].x * 0.016f;
+        positions[i].y += velocities[i].y * 0.016f;
+        positions[i].z += velocities[i].z * 0.016f;
+      }
+    });
+    keep(query);
+  }
+}
+
+UR_BENCHMARK(Ecs_CreateDestroy, 1024) {
+  World world;
+  std::vector<Entity> entities(state.batch());
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      entities[i] = world.create(Position{}, Velocity{});
+    }
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      world.destroy(entities[i]);
+    }
+  }
+}
+
+UR_BENCHMARK(Ecs_AddRemove, 1024) {
+  World world;
+  std::vector<Entity> entities(state.batch());
+  for (uint32_t i = 0; i < state.batch(); ++i) {
+    entities[i] = world.create(Position{}, Velocity{});
+  }
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      world.add(entities[i], Health{1.0f});
+    }
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      world.remove<Health>(entities[i]);
+    }
+  }
+}
+
+UR_BENCHMARK(Ecs_CommandBuffer, 1024) {
+  World world;
+  CommandBuffer commands;
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      Entity entity = commands.create();
+      commands.add(entity, Position{});
+      commands.destroy(entity);
+    }
+    world.apply(commands);
+  }
+}
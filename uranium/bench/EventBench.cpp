@@ -0,0 +1,164 @@
+#include <vector>
+
+#include "Bench.hpp"
+#include "uranium/core/JobSystem.hpp"
+#include "uranium/event/DynamicEventManager.hpp"
+#include "uranium/event/EventDispatcher.hpp"
+
+using namespace uranium::bench;
+using namespace uranium::event;
+
+using Priority = DynamicEventManager::Priority;
+using Concurrency = DynamicEventManager::Concurrency;
+
+static constexpr IEvent::Type BENCH_EVENT =
+    static_cast<IEvent::Type>(IEvent::Builtin::COUNT);
+
+/**
+ * @struct BenchEvent
+ * @brief Small trivially copyable payload, like most input events.
+ */
+struct BenchEvent : IEvent {
+  BenchEvent(uint32_t value) : IEvent(BENCH_EVENT), value(value) {}
+  uint32_t value;
+};
+
+/**
+ * @struct Sink
+ * @brief Listener target accumulating what it receives.
+ */
+struct Sink {
+  void receive(IEvent& event) {
+    total += static_cast<BenchEvent&>(event).value;
+  }
+
+  // Stands for the per-event work of a gameplay listener
+  void simulate(IEvent& event) {
+    uint32_t value = static_cast<BenchEvent&>(event).value;
+    for (uint32_t i = 0; i < 256; ++i) {
+      value = value * 1664525u + 1013904223u;
+    }
+    keep(value);
+  }
+
+  uint64_t total = 0;
+};
+
+UR_BENCHMARK(EventDispatcher_RaiseDispatch, 4096) {
+  EventDispatcher dispatcher;
+  Sink sink;
+  dispatcher.subscribe(BENCH_EVENT, 0,
+                       EventDispatcher::Listener::bind<&Sink::receive>(sink));
+
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      dispatcher.raise<BenchEvent>(i);
+    }
+    dispatcher.dispatch();
+  }
+  keep(sink.total);
+}
+
+UR_BENCHMARK(EventDispatcher_RaisePointer, 4096) {
+  EventDispatcher dispatcher;
+  Sink sink;
+  dispatcher.subscribe(BENCH_EVENT, 0,
+                       EventDispatcher::Listener::bind<&Sink::receive>(sink));
+  std::vector<BenchEvent> events(state.batch(), BenchEvent(1));
+
+  while (state.next()) {
+    for (BenchEvent& event : events) {
+      dispatcher.raise(&event);
+    }
+    dispatcher.dispatch();
+  }
+  keep(sink.total);
+}
+
+UR_BENCHMARK(EventDispatcher_SubscribeChurn, 1024) {
+  EventDispatcher dispatcher;
+  Sink sink;
+  auto listener = EventDispatcher::Listener::bind<&Sink::receive>(sink);
+  std::vector<EventDispatcher::ListenerID> ids(state.batch());
+
+  // One operation is a subscribe followed, later, by its unsubscribe
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      ids[i] = dispatcher.subscribe(BENCH_EVENT, i % 8, listener);
+    }
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      dispatcher.unsubscribe(BENCH_EVENT, ids[i]);
+    }
+  }
+}
+
+UR_BENCHMARK(DynamicEventManager_RaiseDispatch, 4096) {
+  DynamicEventManager manager;
+  Sink sink;
+  manager.add(BENCH_EVENT,
+              DynamicEventManager::Listener::bind<&Sink::receive>(sink));
+
+  constexpr size_t count = static_cast<size_t>(Priority::COUNT);
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      manager.raise<BenchEvent>(static_cast<Priority>(i % count), i);
+    }
+    for (size_t p = 0; p < count; ++p) {
+      manager.dispatch(static_cast<Priority>(p));
+    }
+    manager.endFrame();
+  }
+  keep(sink.total);
+}
+
+UR_BENCHMARK(DynamicEventManager_AddRemoveChurn, 1024) {
+  DynamicEventManager manager;
+  Sink sink;
+  auto listener = DynamicEventManager::Listener::bind<&Sink::receive>(sink);
+  std::vector<DynamicEventManager::ListenerID> ids(state.batch());
+
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      ids[i] = manager.add(BENCH_EVENT, listener);
+    }
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      manager.remove(BENCH_EVENT, ids[i]);
+    }
+  }
+}
+
+UR_BENCHMARK(DynamicEventManager_GameplaySerial, 4096) {
+  DynamicEventManager manager;
+  Sink sinks[4];
+  for (Sink& sink : sinks) {
+    manager.add(BENCH_EVENT,
+                DynamicEventManager::Listener::bind<&Sink::simulate>(sink));
+  }
+
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      manager.raise<BenchEvent>(Priority::GAMEPLAY, i);
+    }
+    manager.dispatch(Priority::GAMEPLAY);
+    manager.endFrame();
+  }
+}
+
+UR_BENCHMARK(DynamicEventManager_GameplayParallel, 4096) {
+  DynamicEventManager manager;
+  uranium::core::JobSystem jobs;
+  Sink sinks[4];
+  for (Sink& sink : sinks) {
+    manager.add(BENCH_EVENT,
+                DynamicEventManager::Listener::bind<&Sink::simulate>(sink),
+                Concurrency::THREAD_SAFE);
+  }
+
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      manager.raise<BenchEvent>(Priority::GAMEPLAY, i);
+    }
+    manager.dispatchParallel(jobs);
+    manager.endFrame();
+  }
+}
@@ -0,0 +1,44 @@
+#include <cmath>
+#include <vector>
+
+#include "Bench.hpp"
+#include "uranium/core/JobSystem.hpp"
+
+using namespace uranium::bench;
+using namespace uranium::core;
+
+static float work(size_t i) { return std::sqrt(static_cast<float>(i)); }
+
+UR_BENCHMARK(JobSystem_SerialLoop, 1) {
+  std::vector<float> values(1 << 20);
+  while (state.next()) {
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = work(i);
+    }
+    keep(values[values.size() / 2]);
+  }
+}
+
+UR_BENCHMARK(JobSystem_ParallelFor, 1) {
+  JobSystem jobs;
+  std::vector<float> values(1 << 20);
+  while (state.next()) {
+    jobs.parallelFor(values.size(), [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        values[i] = work(i);
+      }
+    });
+    keep(values[values.size() / 2]);
+  }
+}
+
+UR_BENCHMARK(JobSystem_EmptyJobs, 1024) {
+  JobSystem jobs;
+  while (state.next()) {
+    JobCounter counter;
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      jobs.run([] {}, &counter);
+    }
+    jobs.wait(counter);
+  }
+}
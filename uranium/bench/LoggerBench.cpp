@@ -0,0 +1,75 @@
+#include <format>
+#include <print>
+#include <string>
+
+#include "Bench.hpp"
+#include "uranium/core/AsyncFileSink.hpp"
+#include "uranium/core/BinaryLog.hpp"
+#include "uranium/core/Logger.hpp"
+
+using namespace uranium::bench;
+using namespace uranium::core;
+
+UR_BENCHMARK(Logger_Format, 4096) {
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      std::string message =
+          std::format("Frame {} took {:.3f} ms on {}", i, i * 0.25, "main");
+      keep(message);
+    }
+  }
+}
+
+// One iteration fits in the ring and is written out untimed before the
+// next, so the drop path is not what gets measured
+UR_BENCHMARK(Logger_FileMessage, AsyncFileSink::CAPACITY) {
+  uint64_t drops = Logger::droppedCount();
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      Logger::fout(LogLevel::INFO, LogCategory::ENGINE,
+                   std::format("Frame {} took {:.3f} ms on {}", i, i * 0.25,
+                               "main"));
+    }
+    state.pause();
+    Logger::flush();
+    state.resume();
+  }
+  std::println("Logger_FileMessage dropped {} records",
+               Logger::droppedCount() - drops);
+}
+
+UR_BENCHMARK(Logger_BinaryMessage, 4096) {
+  BinaryLog::open("uranium_bench.urlog");
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      UR_BLOG(LogLevel::INFO, LogCategory::ENGINE,
+              "Frame {} took {:.3f} ms on {}", i, i * 0.25, "main");
+    }
+  }
+  BinaryLog::close();
+}
+
+// The whole path of an enabled call: level mask, the rate limit of the
+// call site, format, then the console or the file. The site admits
+// LogSite::BURST calls per window, the rest of a flood only pays for the
+// limiter, which is what a subsystem logging every frame costs
+UR_BENCHMARK(Logger_EnabledMessage, 4096) {
+  Logger::setThreshold(LogCategory::ENGINE, LogLevel::INFO);
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      Logger::UR_INFO(LogCategory::ENGINE, "Frame {} took {:.3f} ms on {}", i,
+                      i * 0.25, "main");
+    }
+  }
+  Logger::flush();
+}
+
+UR_BENCHMARK(Logger_DisabledCategory, 4096) {
+  Logger::setThreshold(LogCategory::SHADER, LogLevel::ERROR);
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      Logger::UR_TRACE(LogCategory::SHADER, "Frame {} took {:.3f} ms on {}",
+                       i, i * 0.25, "main");
+    }
+  }
+}
@@ -0,0 +1,65 @@
+#include <vector>
+
+#include "Bench.hpp"
+#include "uranium/math/Batch.hpp"
+#include "uranium/math/Transform.hpp"
+
+using namespace uranium::bench;
+using namespace uranium::math;
+
+static mat4 sampleMatrix() {
+  return Transform(vec3(1.0f, 2.0f, 3.0f),
+                   quat::axisAngle(normalize(vec3(1.0f, 1.0f, 0.0f)), 0.5f),
+                   vec3(2.0f))
+      .toMatrix();
+}
+
+UR_BENCHMARK(Math_TransformPointsAoS, 4096) {
+  const mat4 m = sampleMatrix();
+  std::vector<vec3> points(state.batch(), vec3(1.0f, 2.0f, 3.0f));
+  std::vector<vec3> out(state.batch());
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      out[i] = transformPoint(m, points[i]);
+    }
+    keep(out.back());
+  }
+}
+
+UR_BENCHMARK(Math_TransformPointsSoA, 4096) {
+  const mat4 m = sampleMatrix();
+  std::vector<float> x(state.batch(), 1.0f), y(state.batch(), 2.0f),
+      z(state.batch(), 3.0f);
+  std::vector<float> ox(state.batch()), oy(state.batch()), oz(state.batch());
+  while (state.next()) {
+    transformPoints(m, {x.data(), y.data(), z.data()},
+                    {ox.data(), oy.data(), oz.data()}, state.batch());
+    keep(ox.back());
+  }
+}
+
+UR_BENCHMARK(Math_Hierarchy, 1024) {
+  // A chain of four bones under each root
+  std::vector<mat4> locals(state.batch(), sampleMatrix());
+  std::vector<mat4> worlds(state.batch());
+  std::vector<uint32_t> parents(state.batch());
+  for (uint32_t i = 0; i < state.batch(); ++i) {
+    parents[i] = i % 4 == 0 ? NO_PARENT : i - 1;
+  }
+  while (state.next()) {
+    multiplyHierarchy(locals.data(), parents.data(), worlds.data(),
+                      state.batch());
+    keep(worlds.back());
+  }
+}
+
+UR_BENCHMARK(Math_QuatSlerp, 1024) {
+  quat a = quat::axisAngle(vec3(0.0f, 1.0f, 0.0f), 0.1f);
+  quat b = quat::axisAngle(vec3(1.0f, 0.0f, 0.0f), 2.0f);
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      a = slerp(a, b, 0.001f);
+    }
+    keep(a);
+  }
+}
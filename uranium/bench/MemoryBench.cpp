@@ -0,0 +1,81 @@
+#include <memory>
+#include <vector>
+
+#include "Bench.hpp"
+#include "uranium/memory/FrameAllocator.hpp"
+#include "uranium/memory/PoolAllocator.hpp"
+#include "uranium/memory/StdAllocator.hpp"
+
+using namespace uranium::bench;
+using namespace uranium::core;
+using namespace uranium::memory;
+
+struct Particle {
+  float position[3];
+  float velocity[3];
+};
+
+// The Memory_Heap* baselines include the global new/delete hooks when
+// built with URANIUM_TRACK_MEMORY, compare them in untracked builds
+UR_BENCHMARK(Memory_HeapTransient, 1024) {
+  std::vector<std::unique_ptr<Particle>> particles(state.batch());
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      particles[i] = std::make_unique<Particle>();
+    }
+    keep(particles.back().get());
+  }
+}
+
+UR_BENCHMARK(Memory_FrameTransient, 1024) {
+  FrameAllocator frame;
+  std::vector<Particle*> particles(state.batch());
+  while (state.next()) {
+    frame.beginFrame();
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      void* memory = frame.allocate(sizeof(Particle), alignof(Particle),
+                                    LogCategory::ENGINE);
+      particles[i] = ::new (memory) Particle();
+    }
+    keep(particles.back());
+  }
+}
+
+UR_BENCHMARK(Memory_HeapVector, 64) {
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      std::vector<float> values;
+      values.reserve(256);
+      values.push_back(1.0f);
+      keep(values.data());
+    }
+  }
+}
+
+UR_BENCHMARK(Memory_FrameVector, 64) {
+  FrameAllocator frame;
+  while (state.next()) {
+    frame.beginFrame();
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      FrameVector<float> values(
+          StdAllocator<float, FrameAllocator>(frame, LogCategory::ENGINE));
+      values.reserve(256);
+      values.push_back(1.0f);
+      keep(values.data());
+    }
+  }
+}
+
+UR_BENCHMARK(Memory_PoolChurn, 1024) {
+  PoolAllocator pool(sizeof(Particle), alignof(Particle), 1024);
+  std::vector<void*> blocks(state.batch());
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      blocks[i] = pool.allocate(sizeof(Particle), alignof(Particle),
+                                LogCategory::ENGINE);
+    }
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      pool.deallocate(blocks[i], sizeof(Particle), LogCategory::ENGINE);
+    }
+  }
+}
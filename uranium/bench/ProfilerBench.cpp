@@ -0,0 +1,13 @@
+#include "Bench.hpp"
+#include "uranium/core/Profiler.hpp"
+
+using namespace uranium::bench;
+using namespace uranium::core;
+
+UR_BENCHMARK(Profiler_Scope, 1024) {
+  while (state.next()) {
+    for (uint32_t i = 0; i < state.batch(); ++i) {
+      ProfileScope scope("Profiler_Scope");
+    }
+  }
+}
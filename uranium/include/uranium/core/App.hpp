@@ -7,15 +7,33 @@
  *******************************************************************/
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 
+#include "FrameStats.hpp"
 #include "IMonitor.hpp"
+#include "JobSystem.hpp"
+#include "LaunchOptions.hpp"
+#include "SystemScheduler.hpp"
 #include "Types.hpp"
+#include "uranium/memory/FrameAllocator.hpp"
 
 namespace uranium::core {
 
   UR_ABSTRACT_CLASS IApp {  //: UR_IMPLEMENTS events::ApplicationListener {
+  public:
+    /**
+     * @struct LoopSettings
+     * @brief Tuning of the main loop, read when it starts.
+     */
+    struct LoopSettings {
+      double tick_rate = 60.0;           // Simulation ticks per second
+      double frame_rate_cap = 240.0;     // Frames per second, 0 is uncapped
+      uint32_t max_ticks_per_frame = 8;  // Spiral-of-death clamp
+      double max_frame_time = 0.25;      // Longest frame simulated, seconds
+    };
+
   public:
     /**
      * @brief Constructor for the IApp class.
@@ -30,14 +48,70 @@ namespace uranium::core {
      */
     void exit() noexcept;
 
+    /**
+     * @brief Number of simulation ticks run so far.
+     */
+    uint64_t tickCount() const noexcept { return ticks; }
+
+    /**
+     * @brief Number of frames rendered so far.
+     */
+    uint64_t frameCount() const noexcept { return frames; }
+
+    /**
+     * @brief Applies the engine flags of the command line. Call it before
+     *        the application runs, main() does so with the arguments it
+     *        gives to launchApp.
+     *
+     *        Headless runs advance the simulation by exactly one tick per
+     *        frame and ignore the frame cap, so a run of N frames always
+     *        simulates the same work and times only the CPU side.
+     */
+    void configure(const LaunchOptions& options);
+
+    /**
+     * @brief Engine flags the application was launched with.
+     */
+    const LaunchOptions& launchOptions() const noexcept { return launch; }
+
   protected:
     // Derived classes may need a reference to the engine or other resources
     // Placeholder for future engine reference if needed
     // std::shared_ptr<Engine> engine;
 
-    // virtual void onInit() = 0;
-    // virtual void onUpdate() = 0;
-    // virtual void onShutdown() = 0;
+    /**
+     * @brief Called once before the main loop starts.
+     */
+    virtual void onInit() {}
+
+    /**
+     * @brief Advances the simulation by one fixed tick.
+     *
+     * @param dt Length of a tick in seconds, 1 / tick_rate.
+     */
+    virtual void onUpdate([[maybe_unused]] double dt) {}
+
+    /**
+     * @brief Renders a frame, once per loop iteration, after the systems
+     *        of the frame have run.
+     *
+     * @param alpha Fraction of a tick left in the accumulator, in [0, 1).
+     *              Blend the previous and current simulation states with
+     *              it to render smoothly between ticks.
+     */
+    virtual void onRender([[maybe_unused]] double alpha) {}
+
+    /**
+     * @brief Called once after the main loop exits.
+     */
+    virtual void onShutdown() {}
+
+    /**
+     * @brief Processes the events of the platform, once at the start of
+     *        every frame. The loop exits once it returns false, e.g. when
+     *        the window was closed.
+     */
+    virtual bool pollEvents() = 0;
 
     /**
      * @brief Provides the primary monitor.
@@ -56,8 +130,27 @@ namespace uranium::core {
 
   protected:
     std::unique_ptr<IMonitor> monitor;
+    LoopSettings loop;
+    LaunchOptions launch;
+
+    // Engine systems, run once per frame on the job system. Register them
+    // from onInit()
+    SystemScheduler systems;
+    std::unique_ptr<JobSystem> jobs;
+
+    // Transient memory of the frame, released two frames later
+    memory::FrameAllocator frame_memory;
+
+    // Frame times of the run, logged at exit and written to the
+    // --bench-out file if given
+    FrameStats frame_stats;
 
   private:
+    friend class App;
+
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+
     void init();
     void run();
     void shutdown();
@@ -92,6 +185,8 @@ namespace uranium::core {
 
   private:
     bool is_running;
+    uint64_t ticks;
+    uint64_t frames;
   };
 
   /**
@@ -135,6 +230,12 @@ namespace uranium::core {
      */
     static std::unique_ptr<IApp> release();
 
+    /**
+     * @brief Initializes the borrowed application, runs its main loop
+     *        until it exits and shuts it down.
+     */
+    static void run();
+
   private:
     App() = default;
     ~App() = default;
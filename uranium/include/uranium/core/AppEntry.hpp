@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "App.hpp"
+#include "LaunchOptions.hpp"
 #include "Types.hpp"
 #include "Utils.hpp"
 
@@ -19,6 +20,8 @@ namespace uranium::core {
    * @namespace AppEntry
    * @brief Namespace for application entry point functions.
    *        Contains functions to create and manage the application entry point.
+   *        The engine flags of args (see LaunchOptions) are applied to the
+   *        returned application, launchApp may read them to pick one.
    */
   extern std::unique_ptr<IApp> launchApp(std::vector<std::string>& args);
 }  // namespace uranium::core
@@ -39,10 +42,14 @@ int main(int argc, char** argv) {
     return 1;
   }
 
+  // Apply the engine flags, e.g. --headless --frames N
+  app->configure(uranium::core::LaunchOptions::parse(args));
+
   // Set the application instance in the App singleton
   uranium::core::App::borrow(std::move(app));
 
   // Run the application
+  uranium::core::App::run();
 
   // Claim back the application instance and let the default destructor handle
   // cleanup
@@ -0,0 +1,162 @@
+/*******************************************************************
+ * @file   AsyncFileSink.hpp
+ * @brief  Log file written by a background thread in large batches.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "MPSCRing.hpp"
+#include "Types.hpp"
+
+namespace uranium::core {
+
+  /**
+   * @class AsyncFileSink
+   * @brief Appends text records to a file without ever blocking the
+   *        threads that log.
+   *
+   *        Records are formatted straight into the cells of a lock-free
+   *        ring. A background thread wakes up every FLUSH_INTERVAL, or as
+   *        soon as the ring fills past HIGH_WATER, drains the ring into a
+   *        batch buffer and writes it with a single call. When the ring is
+   *        full the record is dropped and counted, and the number of
+   *        dropped records is written to the file later.
+   */
+  class AsyncFileSink final {
+  public:
+    // Size of a record, longer lines are truncated
+    static inline constexpr size_t RECORD_SIZE = 512;
+    static inline constexpr size_t CAPACITY = 2048;
+    // Queued records that wake the writer before its interval
+    static inline constexpr size_t HIGH_WATER = CAPACITY / 2;
+    static inline constexpr size_t BATCH_SIZE = 64 * 1024;
+    static inline constexpr std::chrono::milliseconds FLUSH_INTERVAL{10};
+
+    /**
+     * @struct Record
+     * @brief One line of text, as stored in the ring.
+     */
+    struct Record {
+      uint16_t length;
+      char text[RECORD_SIZE - sizeof(uint16_t)];
+    };
+
+  public:
+    /**
+     * @brief Constructs a sink with no file open.
+     */
+    explicit AsyncFileSink() noexcept;
+
+    /**
+     * @brief Writes every pending record and closes the file.
+     */
+    ~AsyncFileSink() noexcept;
+
+    AsyncFileSink(const AsyncFileSink&) = delete;
+    AsyncFileSink& operator=(const AsyncFileSink&) = delete;
+
+    /**
+     * @brief Opens the file, appending to it, and starts the writer thread.
+     *
+     * @param path Path of the log file.
+     * @return true if the file could be opened.
+     */
+    bool open(std::string_view path);
+
+    /**
+     * @brief Writes every pending record, stops the writer thread and
+     *        closes the file.
+     */
+    void close();
+
+    /**
+     * @brief Queues a record without blocking. Safe from any thread.
+     *
+     * @param fill Writes the text into the given buffer and returns its
+     *             length, e.g. through std::format_to_n. The length may
+     *             exceed the buffer, the record is then truncated.
+     * @return true if the record was queued, false if it was dropped.
+     */
+    template <typename Fill>
+    bool push(Fill&& fill) noexcept {
+      // Counted before the record is visible, so the writer never takes
+      // away more than was added
+      size_t queued = pending.fetch_add(1, std::memory_order_relaxed) + 1;
+
+      bool stored = ring.tryProduce([&](Record& record) {
+        size_t length = fill(record.text, sizeof(record.text));
+        if (length > sizeof(record.text)) {
+          // Keep the line ending of truncated records
+          length = sizeof(record.text);
+          record.text[length - 1] = '\n';
+        }
+        record.length = static_cast<uint16_t>(length);
+      });
+
+      if (!stored) {
+        pending.fetch_sub(1, std::memory_order_relaxed);
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+
+      // Only the producer crossing the mark signals, without the mutex. A
+      // wakeup lost to the race is caught at the next interval
+      if (queued == HIGH_WATER) {
+        backlog.store(true, std::memory_order_relaxed);
+        wake.notify_one();
+      }
+      return true;
+    }
+
+    /**
+     * @brief Blocks until every record queued so far is written to disk.
+     *        Meant for fatal errors and shutdown, not for the hot path.
+     */
+    void flush();
+
+    /**
+     * @brief Checks if a file is open.
+     */
+    bool isOpen() const noexcept;
+
+    /**
+     * @brief Number of records dropped because the ring was full.
+     */
+    uint64_t droppedCount() const noexcept;
+
+  private:
+    void work();
+    bool drain();
+    void writeBatch();
+
+  private:
+    MPSCRing<Record, CAPACITY> ring;
+    std::atomic<size_t> pending;  // Records queued and not drained yet
+    std::atomic<bool> backlog;    // Set when pending reached HIGH_WATER
+    std::atomic<uint64_t> dropped;
+    uint64_t reported_drops;
+
+    std::FILE* file;
+    std::vector<char> batch;
+    std::thread writer;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable flushed;
+    uint64_t flush_requests;
+    uint64_t flush_done;
+    std::atomic<bool> open_flag;
+    bool stopping;
+  };
+}  // namespace uranium::core
@@ -0,0 +1,252 @@
+/*******************************************************************
+ * @file   BinaryLog.hpp
+ * @brief  Deferred-format logging into per-thread binary buffers.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include "Logger.hpp"
+#include "Types.hpp"
+
+namespace uranium::core {
+
+  /**
+   * @brief Layout of a .urlog file. Every field is stored in the byte
+   *        order of the machine that wrote it. Sites may appear after the
+   *        records that use them.
+   *
+   *        header : MAGIC u32, VERSION u16, reserved u16,
+   *                 clock at open in ns u64
+   *        site   : SITE u8, id u32, level u8, category u8,
+   *                 format length u16, format, argument count u8, tags
+   *        record : RECORD u8, thread u16, length u16, then length bytes
+   *                 of: id u32, clock in ns u64, arguments
+   *        drops  : DROPS u8, thread u16, count u32
+   *
+   *        Arguments are stored raw, strings as a u16 length and their
+   *        bytes. Their tags are listed in ArgTag.
+   */
+  namespace urlog {
+    static inline constexpr uint32_t MAGIC = 0x474C5255;  // "URLG"
+    static inline constexpr uint16_t VERSION = 1;
+
+    static inline constexpr uint8_t SITE = 0;
+    static inline constexpr uint8_t RECORD = 1;
+    static inline constexpr uint8_t DROPS = 2;
+
+    /**
+     * @enum ArgTag
+     * @brief How an argument is stored in a record.
+     */
+    enum ArgTag : char {
+      BOOL = 'b',    // u8
+      CHAR = 'c',    // char
+      INT32 = 'i',   // i32
+      INT64 = 'I',   // i64
+      UINT32 = 'u',  // u32
+      UINT64 = 'U',  // u64
+      DOUBLE = 'd',  // double
+      STRING = 's',  // u16 length, bytes
+      POINTER = 'p'  // u64
+    };
+  }  // namespace urlog
+
+  /**
+   * @class BinaryLog
+   * @brief Records log calls as a call-site ID plus the raw bytes of their
+   *        arguments, and leaves the formatting to the offline decoder.
+   *
+   *        Each thread appends to its own lock-free byte ring, so a call
+   *        costs a clock read and a few stores. A background thread drains
+   *        every ring into the .urlog file. When a ring is full, or a record
+   *        does not fit the stack buffer, the record is dropped and the
+   *        number of drops is written to the file.
+   *
+   *        Use it through UR_BLOG, the decoder lives in tools/urlog.
+   */
+  class BinaryLog final {
+  public:
+    static inline constexpr size_t BUFFER_SIZE = 64 * 1024;
+    static inline constexpr size_t MAX_ARGS = 16;
+    static inline constexpr std::chrono::milliseconds FLUSH_INTERVAL{10};
+
+  public:
+    /**
+     * @brief Opens the .urlog file and starts the writer thread.
+     *
+     * @param path Path of the file, truncated.
+     * @return true if the file could be opened.
+     */
+    static bool open(std::string_view path) noexcept;
+
+    /**
+     * @brief Writes every pending record and closes the file.
+     */
+    static void close() noexcept;
+
+    /**
+     * @brief Checks if a file is open. Calls made while it is not are
+     *        discarded before touching any buffer.
+     */
+    static bool isOpen() noexcept {
+      return opened.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Registers a call site. Called once per site by UR_BLOG.
+     *
+     * @param lvl - Log level of the site.
+     * @param cat - Log category of the site.
+     * @param fmt - std::format string, rendered by the decoder.
+     * @return The ID the records of the site are written with.
+     */
+    template <typename... Args>
+    static uint32_t enroll(LogLevel lvl, LogCategory cat,
+                           std::string_view fmt) {
+      static_assert(sizeof...(Args) <= MAX_ARGS, "Too many log arguments.");
+      static constexpr char tags[] = {tagOf<std::decay_t<Args>>()..., '\0'};
+      return enroll(lvl, cat, fmt, std::string_view(tags, sizeof...(Args)));
+    }
+
+    /**
+     * @brief Appends a record of a call site to the thread buffer.
+     *
+     * @param id   The ID given by enroll().
+     * @param args The raw arguments.
+     */
+    template <typename... Args>
+    static void write(uint32_t id, const Args&... args) noexcept {
+      uint64_t time = static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              Clock::now().time_since_epoch())
+              .count());
+
+      size_t size = sizeof(id) + sizeof(time) + (sizeOf(args) + ... + 0);
+      std::byte record[sizeof(id) + sizeof(time) + MAX_ARGS * 8 + 512];
+      if (size > sizeof(record)) {
+        drop();  // Only reachable with very long strings
+        return;
+      }
+
+      std::byte* out = record;
+      out = put(out, id);
+      out = put(out, time);
+      ((out = encode(out, args)), ...);
+      push(record, size);
+    }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    template <typename T>
+    static constexpr char tagOf() {
+      if constexpr (std::is_same_v<T, bool>) {
+        return urlog::BOOL;
+      } else if constexpr (std::is_same_v<T, char>) {
+        return urlog::CHAR;
+      } else if constexpr (std::is_enum_v<T>) {
+        return tagOf<std::underlying_type_t<T>>();
+      } else if constexpr (std::is_integral_v<T>) {
+        if constexpr (std::is_signed_v<T>) {
+          return sizeof(T) <= 4 ? urlog::INT32 : urlog::INT64;
+        } else {
+          return sizeof(T) <= 4 ? urlog::UINT32 : urlog::UINT64;
+        }
+      } else if constexpr (std::is_floating_point_v<T>) {
+        return urlog::DOUBLE;
+      } else if constexpr (std::is_convertible_v<T, std::string_view>) {
+        return urlog::STRING;
+      } else if constexpr (std::is_pointer_v<T>) {
+        return urlog::POINTER;
+      } else {
+        static_assert(sizeof(T) == 0, "Unsupported binary log argument.");
+      }
+    }
+
+    template <typename T>
+    static size_t sizeOf(const T& value) noexcept {
+      constexpr char tag = tagOf<T>();
+      if constexpr (tag == urlog::STRING) {
+        return sizeof(uint16_t) + clip(std::string_view(value)).size();
+      } else if constexpr (tag == urlog::BOOL || tag == urlog::CHAR) {
+        return 1;
+      } else if constexpr (tag == urlog::INT32 || tag == urlog::UINT32) {
+        return 4;
+      } else {
+        return 8;
+      }
+    }
+
+    template <typename T>
+    static std::byte* encode(std::byte* out, const T& value) noexcept {
+      constexpr char tag = tagOf<T>();
+      if constexpr (tag == urlog::STRING) {
+        std::string_view text = clip(std::string_view(value));
+        out = put(out, static_cast<uint16_t>(text.size()));
+        std::memcpy(out, text.data(), text.size());
+        return out + text.size();
+      } else if constexpr (tag == urlog::POINTER) {
+        return put(out, reinterpret_cast<uint64_t>(value));
+      } else if constexpr (tag == urlog::BOOL || tag == urlog::CHAR) {
+        return put(out, static_cast<uint8_t>(value));
+      } else if constexpr (tag == urlog::INT32) {
+        return put(out, static_cast<int32_t>(value));
+      } else if constexpr (tag == urlog::INT64) {
+        return put(out, static_cast<int64_t>(value));
+      } else if constexpr (tag == urlog::UINT32) {
+        return put(out, static_cast<uint32_t>(value));
+      } else if constexpr (tag == urlog::UINT64) {
+        return put(out, static_cast<uint64_t>(value));
+      } else {
+        return put(out, static_cast<double>(value));
+      }
+    }
+
+    template <typename T>
+    static std::byte* put(std::byte* out, const T& value) noexcept {
+      std::memcpy(out, &value, sizeof(T));
+      return out + sizeof(T);
+    }
+
+    static std::string_view clip(std::string_view text) noexcept {
+      return text.substr(0, 255);
+    }
+
+    static uint32_t enroll(LogLevel lvl, LogCategory cat,
+                           std::string_view fmt, std::string_view tags);
+    static void push(const std::byte* record, size_t size) noexcept;
+    static void drop() noexcept;
+
+  private:
+    static inline std::atomic<bool> opened{false};
+  };
+}  // namespace uranium::core
+
+/*
+ * @brief Logs a message in binary form. Arguments are copied raw into the
+ *        thread buffer and formatted later by the urlog decoder, so they
+ *        must be arithmetic, enums, pointers or strings.
+ *
+ * @param lvl - Log level (e.g., LogLevel::TRACE).
+ * @param cat - Log category (e.g., LogCategory::RENDERER).
+ * @param msg - std::format string literal.
+ */
+#define UR_BLOG(lvl, cat, msg, ...)                                         \
+  do {                                                                      \
+    if (::uranium::core::BinaryLog::isOpen()) {                             \
+      [&]<typename... UrArgs>(const UrArgs&... ur_args) {                   \
+        static const uint32_t ur_site =                                     \
+            ::uranium::core::BinaryLog::enroll<UrArgs...>(lvl, cat, msg);   \
+        ::uranium::core::BinaryLog::write(ur_site, ur_args...);             \
+      }(__VA_ARGS__);                                                       \
+    }                                                                       \
+  } while (false)
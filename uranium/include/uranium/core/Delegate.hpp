@@ -0,0 +1,183 @@
+/*******************************************************************
+ * @file   Delegate.hpp
+ * @brief  Callable wrapper with inline storage that never allocates.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Types.hpp"
+
+namespace uranium::core {
+
+  template <typename Signature, size_t Capacity = 48>
+  class Delegate;
+
+  /**
+   * @class Delegate
+   * @brief Replacement for std::function used on hot paths.
+   *
+   *        The callable is always stored inside the delegate. Callables
+   *        that do not fit in Capacity bytes are rejected at compile time
+   *        instead of falling back to the heap. Member functions bound with
+   *        bind() only store the object pointer.
+   *
+   * @tparam R        Return type of the call.
+   * @tparam Args     Argument types of the call.
+   * @tparam Capacity Size in bytes of the inline storage.
+   */
+  template <typename R, typename... Args, size_t Capacity>
+  class Delegate<R(Args...), Capacity> final {
+  public:
+    Delegate() noexcept = default;
+    Delegate(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Stores a copy of any callable that fits the inline storage.
+     *
+     * @param callable Lambda, functor or function pointer.
+     */
+    template <typename F,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::decay_t<F>, Delegate> &&
+                  std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+    Delegate(F&& callable) noexcept(
+        std::is_nothrow_constructible_v<std::decay_t<F>, F&&>) {
+      using Fn = std::decay_t<F>;
+      static_assert(sizeof(Fn) <= Capacity,
+                    "Callable is too large for the delegate storage, capture "
+                    "less state or bind a member function instead.");
+      static_assert(alignof(Fn) <= alignof(std::max_align_t),
+                    "Callable is over-aligned for the delegate storage.");
+
+      ::new (static_cast<void*>(storage)) Fn(std::forward<F>(callable));
+      invoker = [](void* target, Args... args) -> R {
+        return (*static_cast<Fn*>(target))(std::forward<Args>(args)...);
+      };
+
+      // Trivial callables are moved and copied as raw bytes
+      if constexpr (!std::is_trivially_copyable_v<Fn>) {
+        manager = [](Operation op, void* dst, void* src) {
+          switch (op) {
+            case Operation::COPY:
+              ::new (dst) Fn(*static_cast<const Fn*>(src));
+              break;
+            case Operation::MOVE:
+              ::new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+              static_cast<Fn*>(src)->~Fn();
+              break;
+            case Operation::DESTROY:
+              static_cast<Fn*>(dst)->~Fn();
+              break;
+          }
+        };
+      }
+    }
+
+    /**
+     * @brief Creates a delegate calling a member function on an object.
+     *
+     * @tparam Method Pointer to the member function.
+     * @param instance The object the method is called on.
+     */
+    template <auto Method, typename Class>
+    static Delegate bind(Class& instance) noexcept {
+      return Delegate([object = &instance](Args... args) -> R {
+        return (object->*Method)(std::forward<Args>(args)...);
+      });
+    }
+
+    /**
+     * @brief Creates a delegate calling a free function.
+     *
+     * @tparam Function Pointer to the function.
+     */
+    template <auto Function>
+    static Delegate bind() noexcept {
+      return Delegate([](Args... args) -> R {
+        return Function(std::forward<Args>(args)...);
+      });
+    }
+
+    Delegate(const Delegate& other) { copyFrom(other); }
+    Delegate(Delegate&& other) noexcept { moveFrom(other); }
+
+    Delegate& operator=(const Delegate& other) {
+      if (this != &other) {
+        reset();
+        copyFrom(other);
+      }
+      return *this;
+    }
+
+    Delegate& operator=(Delegate&& other) noexcept {
+      if (this != &other) {
+        reset();
+        moveFrom(other);
+      }
+      return *this;
+    }
+
+    ~Delegate() noexcept { reset(); }
+
+    /**
+     * @brief Destroys the stored callable, leaving the delegate empty.
+     */
+    void reset() noexcept {
+      if (manager) {
+        manager(Operation::DESTROY, storage, nullptr);
+      }
+      invoker = nullptr;
+      manager = nullptr;
+    }
+
+    /**
+     * @brief Calls the stored callable. The delegate must not be empty.
+     */
+    R operator()(Args... args) const {
+      return invoker(storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept { return invoker != nullptr; }
+
+  private:
+    enum class Operation { COPY, MOVE, DESTROY };
+
+    using Invoker = R (*)(void*, Args...);
+    using Manager = void (*)(Operation, void*, void*);
+
+    void copyFrom(const Delegate& other) {
+      if (other.manager) {
+        other.manager(Operation::COPY, storage, other.storage);
+      } else if (other.invoker) {
+        std::memcpy(storage, other.storage, Capacity);
+      }
+      invoker = other.invoker;
+      manager = other.manager;
+    }
+
+    void moveFrom(Delegate& other) noexcept {
+      if (other.manager) {
+        other.manager(Operation::MOVE, storage, other.storage);
+      } else if (other.invoker) {
+        std::memcpy(storage, other.storage, Capacity);
+      }
+      invoker = other.invoker;
+      manager = other.manager;
+      other.invoker = nullptr;
+      other.manager = nullptr;
+    }
+
+  private:
+    alignas(std::max_align_t) mutable std::byte storage[Capacity];
+    Invoker invoker = nullptr;
+    Manager manager = nullptr;
+  };
+}  // namespace uranium::core
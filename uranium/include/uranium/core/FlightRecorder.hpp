@@ -0,0 +1,164 @@
+/*******************************************************************
+ * @file   FlightRecorder.hpp
+ * @brief  Crash-safe log sink writing into memory-mapped files.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Logger.hpp"
+#include "Types.hpp"
+
+namespace uranium::core {
+
+  /**
+   * @class FlightRecorder
+   * @brief Keeps the last few megabytes of log records in a set of
+   *        memory-mapped files, so they survive a crash of the process.
+   *
+   *        The files are mapped once and used as a ring: when one fills up
+   *        the recorder rotates to the next, overwriting the oldest. A
+   *        record is reserved with one fetch_add, copied in place and
+   *        committed with a release store of its stamp. The mapping is
+   *        shared with the page cache, so whatever was committed reaches
+   *        the disk even if the process dies, without any fsync.
+   *
+   *        A thread stalled in the middle of a record while the others
+   *        write the whole ring may see its record overwritten. The stamps
+   *        make the reader skip such torn records.
+   *
+   *        Files are named "<base>-<slot>.urfr". The files of the previous
+   *        run are renamed to "<base>.prev-<slot>.urfr" when opening, read
+   *        them back with dump().
+   */
+  class FlightRecorder final {
+  public:
+    static inline constexpr size_t FILE_SIZE = 1024 * 1024;
+    static inline constexpr uint32_t FILES = 4;
+    static inline constexpr size_t ALIGNMENT = 8;
+
+    static inline constexpr uint32_t MAGIC = 0x52465255;  // "URFR"
+    static inline constexpr uint16_t VERSION = 1;
+
+    /**
+     * @struct FileHeader
+     * @brief Start of every file. The generation tells the order of the
+     *        files, it is EMPTY until the first record is written.
+     */
+    struct FileHeader {
+      uint32_t magic;
+      uint16_t version;
+      uint16_t reserved;
+      uint64_t generation;
+    };
+
+    /**
+     * @struct RecordHeader
+     * @brief Start of every record, followed by the text. The commit
+     *        stamp is written last, records with a stale stamp are skipped.
+     */
+    struct RecordHeader {
+      uint32_t size;    // Whole record, aligned to ALIGNMENT
+      uint32_t commit;  // Stamp of the generation, PADDING if unused
+      uint64_t time;    // System clock in ns
+      uint8_t level;
+      uint8_t category;
+      uint16_t length;
+    };
+
+    static inline constexpr uint64_t EMPTY = ~uint64_t(0);
+    static inline constexpr uint32_t PADDING = 0x80000000;
+
+  public:
+    /**
+     * @brief Constructs a recorder with no file open.
+     */
+    explicit FlightRecorder() noexcept;
+
+    /**
+     * @brief Unmaps the files.
+     */
+    ~FlightRecorder() noexcept;
+
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    /**
+     * @brief Creates and maps the files, keeping the ones of the previous
+     *        run under the ".prev" base.
+     *
+     * @param base      Path of the files without the slot and extension.
+     * @param file_size Size of each file, the rotation threshold.
+     * @param files     Number of files in the ring.
+     * @return true if every file could be mapped.
+     */
+    bool open(std::string_view base, size_t file_size = FILE_SIZE,
+              uint32_t files = FILES) noexcept;
+
+    /**
+     * @brief Unmaps the files. No thread may be recording meanwhile.
+     */
+    void close() noexcept;
+
+    /**
+     * @brief Copies a record into the current file. Lock-free and safe
+     *        from any thread, long messages are truncated.
+     *
+     * @param lvl - Log level (e.g., INFO, DEBUG, ERROR).
+     * @param cat - Log category (e.g., SYSTEM, ENGINE).
+     * @param msg - The formatted message.
+     */
+    void record(LogLevel lvl, LogCategory cat, std::string_view msg) noexcept;
+
+    /**
+     * @brief Checks if the files are mapped.
+     */
+    bool isOpen() const noexcept;
+
+    /**
+     * @brief Writes the committed records of a set of files as text, oldest
+     *        first.
+     *
+     * @param base Path of the files, e.g. "uranium.prev".
+     * @param out  Where the text goes.
+     * @return The number of records written.
+     */
+    static size_t dump(std::string_view base, std::FILE* out);
+
+    /**
+     * @brief Path of the file in a slot.
+     */
+    static std::string pathOf(std::string_view base, uint32_t slot);
+
+  private:
+    /**
+     * @struct Mapping
+     * @brief One mapped file.
+     */
+    struct Mapping {
+      std::byte* data;
+      size_t size;
+    };
+
+    void begin(uint64_t generation) noexcept;
+    void pad(uint64_t generation, uint64_t offset, uint64_t size) noexcept;
+    RecordHeader* at(uint64_t generation, uint64_t offset) noexcept;
+
+    static uint32_t stampOf(uint64_t generation) noexcept;
+    static bool map(const std::string& path, size_t size, Mapping& mapping);
+    static void unmap(Mapping& mapping) noexcept;
+
+  private:
+    std::vector<Mapping> mappings;
+    uint64_t capacity;  // Bytes of records in each file
+    alignas(UR_CACHE_LINE) std::atomic<uint64_t> cursor;
+    std::atomic<bool> open_flag;
+  };
+}  // namespace uranium::core
@@ -0,0 +1,129 @@
+/*******************************************************************
+ * @file   FrameStats.hpp
+ * @brief  Frame time percentiles and hitches over fixed windows.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "Histogram.hpp"
+#include "Types.hpp"
+
+namespace uranium::core {
+
+  /**
+   * @class FrameStats
+   * @brief Collects the time of every frame and of its update and present
+   *        phases into histograms, in microseconds.
+   *
+   *        Each metric has a histogram over the whole run and one over the
+   *        current window. When the frames of a window add up to its
+   *        length, it becomes the last window and a new one starts. The
+   *        windows tumble rather than roll: a sliding window would need a
+   *        histogram per frame, or per slice of one, to subtract as frames
+   *        leave it, while one per window is reset in place. Frames over
+   *        the hitch time are counted as hitches, exactly rather than to
+   *        the bucket precision.
+   *
+   *        The JSON summary is meant to be compared between builds.
+   */
+  class FrameStats final {
+  public:
+    enum class Metric {
+      FRAME = 0,  // Loop start to loop start
+      UPDATE,     // Fixed ticks run in the frame
+      PRESENT,    // Rendering and presenting the frame
+      COUNT
+    };
+
+    /**
+     * @struct Settings
+     * @brief Tuning of the collector, in seconds.
+     */
+    struct Settings {
+      double window = 5.0;              // Length of a window
+      double hitch_time = 1.0 / 30.0;  // Slower frames are hitches
+    };
+
+    /**
+     * @struct Summary
+     * @brief Statistics of a metric, times in milliseconds.
+     */
+    struct Summary {
+      uint64_t count = 0;
+      double mean = 0.0;
+      double p50 = 0.0;
+      double p95 = 0.0;
+      double p99 = 0.0;
+      double max = 0.0;
+      uint64_t hitches = 0;
+    };
+
+    static inline constexpr std::string_view DEFAULT_FILE =
+        "uranium.frames.json";
+
+  public:
+    explicit FrameStats() noexcept;
+    explicit FrameStats(const Settings& settings) noexcept;
+
+    /**
+     * @brief Counts a frame, times in seconds.
+     */
+    void record(double frame, double update, double present) noexcept;
+
+    /**
+     * @brief Statistics of the last complete window, empty before the
+     *        first window completes.
+     */
+    Summary window(Metric metric) const noexcept;
+
+    /**
+     * @brief Statistics of every frame recorded.
+     */
+    Summary total(Metric metric) const noexcept;
+
+    /**
+     * @brief Forgets every frame.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Logs the totals of every metric.
+     */
+    void log() const;
+
+    /**
+     * @brief Writes the summaries and the histograms as JSON.
+     *
+     * @param path File to create or overwrite.
+     * @return false if the file could not be written.
+     */
+    bool write(std::string_view path = DEFAULT_FILE) const;
+
+  private:
+    static inline constexpr size_t METRICS =
+        static_cast<size_t>(Metric::COUNT);
+
+    Summary summarize(const Histogram& histogram,
+                      uint64_t hitches) const noexcept;
+
+  private:
+    Settings settings;
+    uint64_t hitch_limit;  // In microseconds
+
+    std::array<Histogram, METRICS> all;
+    std::array<Histogram, METRICS> current;
+    std::array<Histogram, METRICS> last;
+    double window_elapsed;
+
+    // Values over hitch_limit, next to the histograms above
+    std::array<uint64_t, METRICS> all_hitches;
+    std::array<uint64_t, METRICS> current_hitches;
+    std::array<uint64_t, METRICS> last_hitches;
+  };
+}  // namespace uranium::core
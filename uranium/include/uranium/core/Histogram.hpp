@@ -0,0 +1,89 @@
+/*******************************************************************
+ * @file   Histogram.hpp
+ * @brief  Log-linear histogram with bounded relative error.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "Types.hpp"
+
+namespace uranium::core {
+
+  /**
+   * @class Histogram
+   * @brief Counts integer values in buckets whose width grows with the
+   *        value, as in HdrHistogram: every power of two is split into
+   *        SUB_BUCKETS equal buckets, so any value is known within
+   *        1 / SUB_BUCKETS of itself. Recording is an index computation
+   *        and an increment, percentiles walk the buckets.
+   *
+   *        Values of 2^MAX_EXPONENT and above are counted in the last
+   *        bucket, the exact maximum is kept aside.
+   */
+  class Histogram final {
+  public:
+    static inline constexpr uint32_t SUB_BUCKET_BITS = 5;
+    static inline constexpr uint32_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+    static inline constexpr uint32_t MAX_EXPONENT = 40;
+    static inline constexpr size_t BUCKETS =
+        (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+  public:
+    explicit Histogram() noexcept;
+
+    /**
+     * @brief Counts a value.
+     */
+    void record(uint64_t value) noexcept;
+
+    /**
+     * @brief Adds the counts of another histogram.
+     */
+    void merge(const Histogram& other) noexcept;
+
+    /**
+     * @brief Forgets every value.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Smallest value at or above the given fraction of the values.
+     *
+     * @param fraction In [0, 1], e.g. 0.99 for the 99th percentile.
+     * @return The highest value of its bucket, 0 when empty.
+     */
+    uint64_t percentile(double fraction) const noexcept;
+
+    uint64_t count() const noexcept { return total; }
+    uint64_t max() const noexcept { return largest; }
+    double mean() const noexcept;
+
+    /**
+     * @brief Number of values over a threshold, to the bucket precision.
+     *        The bucket of the threshold is counted when it can hold larger
+     *        values, so values over the threshold are never missed.
+     */
+    uint64_t countAbove(uint64_t threshold) const noexcept;
+
+    /**
+     * @brief Counts of a bucket and the highest value it holds.
+     */
+    uint64_t bucketCount(size_t bucket) const noexcept;
+    static uint64_t bucketLimit(size_t bucket) noexcept;
+
+  private:
+    static size_t indexOf(uint64_t value) noexcept;
+
+  private:
+    std::array<uint64_t, BUCKETS> counts;
+    uint64_t total;
+    uint64_t largest;
+    uint64_t sum;
+  };
+}  // namespace uranium::core
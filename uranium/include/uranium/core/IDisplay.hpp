@@ -93,12 +93,29 @@ namespace uranium::core {
                       const IMonitor& smonitor) noexcept;
     virtual ~IDisplay() = default;
 
+  protected:
+    /**
+     * @brief Constructor for displays without a window system, which
+     *        have no monitor to refer to.
+     * @param properties Configuration properties for the display.
+     */
+    explicit IDisplay(const Properties& properties) noexcept;
+
+  public:
+
     /**
      * @brief Closes and cleans up the display.
      *        This must be implemented by derived classes.
      */
     virtual void close() = 0;
 
+    /**
+     * @brief Processes the pending events of the window system. Called
+     *        once per frame by the main loop.
+     * @return False once the display was closed or asked to close.
+     */
+    virtual bool pollEvents() = 0;
+
     /**
      * @brief Reloads the display.
      * @param properties New properties for the display.
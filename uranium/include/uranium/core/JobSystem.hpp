@@ -0,0 +1,201 @@
+/*******************************************************************
+ * @file   JobSystem.hpp
+ * @brief  Work-stealing job system with counters and parallel loops.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Delegate.hpp"
+#include "Types.hpp"
+#include "WorkStealingDeque.hpp"
+
+namespace uranium::core {
+
+  class JobSystem;
+  struct Job;
+
+  /**
+   * @class JobCounter
+   * @brief Counts the jobs submitted with it that have not finished yet.
+   *        Wait on it with JobSystem::wait(), or make other jobs depend on
+   *        it, they are only scheduled once it drops to zero.
+   */
+  class JobCounter final {
+  public:
+    explicit JobCounter() noexcept : pending(0), finishing(0) {}
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    /**
+     * @brief Checks if every job of the counter has finished.
+     */
+    bool done() const noexcept {
+      return pending.load(std::memory_order_acquire) == 0 &&
+             finishing.load(std::memory_order_acquire) == 0;
+    }
+
+  private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> pending;
+
+    // Jobs still touching the counter after their decrement, so it is not
+    // destroyed under them once pending reads zero
+    std::atomic<uint32_t> finishing;
+
+    // Jobs depending on this counter, scheduled when it drops to zero
+    std::mutex mutex;
+    std::vector<Job*> dependents;
+  };
+
+  /**
+   * @struct Job
+   * @brief A task and the counter it finishes. Owned by the worker that
+   *        submitted it, and handed back to it once run.
+   */
+  struct Job {
+    Delegate<void()> task;
+    JobCounter* counter = nullptr;
+    Job* next_free = nullptr;
+    uint32_t owner = 0;
+  };
+
+  /**
+   * @class JobSystem
+   * @brief Runs jobs on one worker thread per core. Every thread owns a
+   *        Chase-Lev deque: it pushes and pops its own jobs at one end,
+   *        and idle threads steal from the other end of the others.
+   *
+   *        The thread that creates the system takes part as well. Jobs may
+   *        be submitted from it and from inside other jobs, other threads
+   *        run what they submit inline. Waiting on a counter runs pending
+   *        jobs instead of blocking.
+   */
+  class JobSystem final {
+  public:
+    using Task = Delegate<void()>;
+
+    /**
+     * @brief Receives a chunk of the iteration range, [begin, end).
+     */
+    using RangeTask = Delegate<void(size_t begin, size_t end)>;
+
+    // Jobs each thread can have in flight. Past that, submitting helps with
+    // pending jobs until one is released, or runs the job inline
+    static inline constexpr size_t MAX_JOBS = 4096;
+
+    // Chunks per thread parallelFor() aims for, to balance uneven work
+    static inline constexpr size_t CHUNKS_PER_THREAD = 4;
+
+  public:
+    /**
+     * @brief Starts the worker threads and registers the calling thread.
+     *        A thread may take part in several systems, each one keeps
+     *        track of its own members.
+     *
+     * @param workers Number of threads besides the caller. Defaults to one
+     *                less than the number of hardware threads.
+     */
+    explicit JobSystem(uint32_t workers = defaultWorkers());
+
+    /**
+     * @brief Stops and joins the worker threads. Wait on every counter
+     *        first, jobs still queued are never run.
+     */
+    ~JobSystem() noexcept;
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Submits a job.
+     *
+     * @param task    The work to run, on any thread.
+     * @param counter Incremented now, decremented when the job finishes.
+     * @param after   The job is only scheduled once this counter is done.
+     */
+    void run(const Task& task, JobCounter* counter = nullptr,
+             JobCounter* after = nullptr);
+
+    /**
+     * @brief Runs other jobs until the counter is done.
+     */
+    void wait(const JobCounter& counter);
+
+    /**
+     * @brief Splits [0, count) into chunks, runs them in parallel and waits
+     *        for all of them.
+     *
+     * @param count Size of the range.
+     * @param task  Invoked once per chunk, possibly concurrently.
+     * @param grain Size of a chunk, 0 picks one from the number of threads.
+     */
+    void parallelFor(size_t count, const RangeTask& task, size_t grain = 0);
+
+    /**
+     * @brief Number of worker threads, not counting the caller.
+     */
+    uint32_t size() const noexcept;
+
+    /**
+     * @brief One worker per hardware thread, minus the calling thread.
+     */
+    static uint32_t defaultWorkers() noexcept;
+
+  private:
+    /**
+     * @struct Worker
+     * @brief Deque and job storage of one thread. A job stays allocated
+     *        while it is queued, parked on a counter or running, and is
+     *        only reused once execute() has released it.
+     */
+    struct alignas(UR_CACHE_LINE) Worker {
+      WorkStealingDeque<Job, MAX_JOBS> deque;
+      std::array<Job, MAX_JOBS> jobs;
+
+      // Free jobs, only touched by the owner
+      Job* free_jobs = nullptr;
+
+      // Jobs released by other threads, taken back by the owner at once
+      alignas(UR_CACHE_LINE) std::atomic<Job*> returned = nullptr;
+
+      uint32_t seed = 0;
+    };
+
+    void work(uint32_t index);
+    Job* allocate(Worker& worker) noexcept;
+    void release(Job* job) noexcept;
+    void schedule(Job* job);
+    void execute(Job* job);
+    void finish(JobCounter& counter);
+    void sleep();
+    Job* find(uint32_t index) noexcept;
+    uint32_t slot() const noexcept;
+    Worker& current();
+
+    // Returned by slot() on threads outside the system
+    static inline constexpr uint32_t NO_SLOT = ~0u;
+
+  private:
+    std::vector<std::unique_ptr<Worker>> workers;  // [0] is the creator
+    std::vector<std::thread> threads;
+    std::thread::id creator;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::atomic<uint64_t> epoch;
+    std::atomic<uint32_t> sleeping;
+    std::atomic<bool> stopping;
+  };
+}  // namespace uranium::core
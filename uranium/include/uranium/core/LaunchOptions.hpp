@@ -0,0 +1,47 @@
+/*******************************************************************
+ * @file   LaunchOptions.hpp
+ * @brief  Engine flags read from the command line.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Types.hpp"
+
+namespace uranium::core {
+
+  /**
+   * @struct LaunchOptions
+   * @brief Flags understood by every application, e.g.
+   *
+   *          game --headless --frames 1000 --bench-out run.json
+   *
+   *        --headless         Run without a window system, see HeadlessApp.
+   *        --frames N         Exit after N frames. Headless runs default to
+   *                           HEADLESS_FRAMES, nothing else would end them.
+   *        --bench-out FILE   Write the frame statistics to FILE.
+   *        --trace-out FILE   Write the profiler zones to FILE, when they
+   *                           are compiled in (URANIUM_PROFILE).
+   *
+   *        Other arguments are left to the application.
+   */
+  struct LaunchOptions final {
+    static inline constexpr uint64_t HEADLESS_FRAMES = 1000;
+
+    bool headless = false;  // No window, one simulation tick per frame
+    uint64_t frames = 0;    // Frames to run, 0 runs until exit()
+    std::string bench_out;  // Frame statistics file, empty for none
+    std::string trace_out;  // Chrome trace file, empty for none
+
+    /**
+     * @brief Reads the engine flags, warning about malformed ones.
+     *
+     * @param args Command line, the program name first.
+     */
+    static LaunchOptions parse(const std::vector<std::string>& args);
+  };
+}  // namespace uranium::core
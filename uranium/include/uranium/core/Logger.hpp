@@ -7,10 +7,37 @@
  *********************************************************************/
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <format>
 
 #include "Types.hpp"
 
+/*
+ * @brief UR_LOG_FLOOR is the least severe level compiled into the build,
+ *        the calls of the levels under it compile to nothing. It can be set
+ *        from the command line, e.g. -DUR_LOG_FLOOR=WARN.
+ *
+ *        UR_LOG_DEFAULT is the runtime threshold every category starts
+ *        with. Levels between the floor and the default can be turned on
+ *        while running with Logger::setThreshold().
+ */
+#if !defined(UR_LOG_FLOOR)
+  #if defined(UR_DIST)
+    #define UR_LOG_FLOOR ERROR
+  #else
+    #define UR_LOG_FLOOR TRACE
+  #endif
+#endif
+
+#if !defined(UR_LOG_DEFAULT)
+  #if defined(UR_DEBUG)
+    #define UR_LOG_DEFAULT TRACE
+  #else
+    #define UR_LOG_DEFAULT INFO
+  #endif
+#endif
+
 namespace uranium::core {
 
   enum class LogLevel {
@@ -37,6 +64,51 @@ namespace uranium::core {
     COUNT
   };
 
+  /**
+   * @class LogSite
+   * @brief Rate limit of one logging call site. The first BURST calls of
+   *        every WINDOW are logged, the rest are only counted and reported
+   *        along with the first call of the next window.
+   */
+  class LogSite final {
+  public:
+    static inline constexpr uint32_t BURST = 5;
+    static inline constexpr std::chrono::seconds WINDOW{1};
+
+  public:
+    /**
+     * @brief Constructs a site at compile time, so a function-local static
+     *        needs no initialization guard.
+     */
+    constexpr LogSite() noexcept : window(0), calls(0) {}
+
+    /**
+     * @brief Counts a call and tells if it should be logged.
+     *
+     * @param repeated Set to the calls dropped in the last window when
+     *                 this one opens a new window, left untouched otherwise.
+     * @return true if the call should be logged.
+     */
+    bool admit(uint32_t& repeated) noexcept {
+      int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch())
+                        .count();
+      int64_t start = window.load(std::memory_order_relaxed);
+      if (now - start >= std::chrono::nanoseconds(WINDOW).count() &&
+          window.compare_exchange_strong(start, now,
+                                         std::memory_order_relaxed)) {
+        uint32_t last = calls.exchange(1, std::memory_order_relaxed);
+        repeated = last > BURST ? last - BURST : 0;
+        return true;
+      }
+      return calls.fetch_add(1, std::memory_order_relaxed) < BURST;
+    }
+
+  private:
+    std::atomic<int64_t> window;  // Start of the current window, in ns
+    std::atomic<uint32_t> calls;  // Calls in the current window
+  };
+
   class Logger final {
   public:
     /**
@@ -75,107 +147,216 @@ namespace uranium::core {
     static void fout(LogLevel lvl, LogCategory cat,
                      std::string_view msg) noexcept;
 
-  private:
+    /**
+     * @brief Opens the file fout() writes to, appending to it. When no file
+     *        has been opened, the first fout() call opens DEFAULT_FILE.
+     *
+     * @param path - Path of the log file.
+     * @return true if the file could be opened.
+     */
+    static bool open(std::string_view path) noexcept;
+
+    /**
+     * @brief Writes the pending file records and closes the log file.
+     */
+    static void close() noexcept;
+
+    /**
+     * @brief Blocks until the pending file records are written.
+     */
+    static void flush() noexcept;
+
+    /**
+     * @brief Number of file records dropped because the writer thread
+     *        fell behind.
+     */
+    static uint64_t droppedCount() noexcept;
+
+    /**
+     * @brief Starts copying every message logged through the UR_* macros
+     *        into a FlightRecorder, kept on disk if the process crashes.
+     *
+     * @param base - Path of the files without slot and extension.
+     * @return true if the files could be mapped.
+     */
+    static bool openFlightRecorder(std::string_view base) noexcept;
+
+    /**
+     * @brief Stops the flight recorder. Call it once no thread logs.
+     */
+    static void closeFlightRecorder() noexcept;
+
+    /**
+     * @brief Enables a level and every more severe one for a category, and
+     *        disables the less severe ones. Takes effect on every thread.
+     *
+     * @param cat - Log category (e.g., SHADER, RESOURCE).
+     * @param lvl - Least severe level to keep (e.g., TRACE).
+     */
+    static void setThreshold(LogCategory cat, LogLevel lvl) noexcept;
+
+    /**
+     * @brief Sets the same threshold for every category.
+     *
+     * @param lvl - Least severe level to keep (e.g., WARN).
+     */
+    static void setThreshold(LogLevel lvl) noexcept;
+
+    /**
+     * @brief Checks the runtime threshold of a category, one relaxed load.
+     */
+    static bool isEnabled(LogLevel lvl, LogCategory cat) noexcept {
+      return (levels.load(std::memory_order_relaxed) & bitOf(lvl, cat)) != 0;
+    }
+
+    /**
+     * @brief Logs the message built by make() if the level is above the
+     *        compile-time floor and enabled for the category. make() is
+     *        only called then, so disabled calls never format anything.
+     *
+     *        Every call site is rate limited by its own LogSite, except for
+     *        FATAL messages. Dropped calls are reported with the next call
+     *        that gets through, which may come much later, e.g.
+     *        "msg [4812 earlier calls suppressed]".
+     *
+     * @param cat  - Log category (e.g., SYSTEM, ENGINE).
+     * @param make - Callable returning the message.
+     */
+    template <LogLevel Lvl, typename Make>
+    static void log(LogCategory cat, Make&& make) {
+      if constexpr (severityOf(Lvl) >= severityOf(FLOOR)) {
+        // The lambda of each macro call is its own type, so is this site
+        static LogSite site;
+
+        uint32_t repeated = 0;
+        if (!isEnabled(Lvl, cat) ||
+            (Lvl != LogLevel::FATAL && !site.admit(repeated))) {
+          return;
+        }
+
+        if (repeated == 0) {
+          write(Lvl, cat, make());
+        } else {
+          write(Lvl, cat,
+                std::format("{} [{} earlier calls suppressed]", make(),
+                            repeated));
+        }
+      }
+    }
+
+    /**
+     * @brief Rank of a level, from TRACE (least severe) to FATAL.
+     */
+    static constexpr uint32_t severityOf(LogLevel lvl) noexcept {
+      constexpr uint32_t ranks[] = {
+          2,  // INFO
+          1,  // DEBUG
+          3,  // WARN
+          0,  // TRACE
+          4,  // ERROR
+          5   // FATAL
+      };
+      return ranks[static_cast<uint32_t>(lvl)];
+    }
+
+    /**
+     * @brief Name of a log level, e.g. "INFO".
+     */
     static std::string_view toString(LogLevel level) noexcept;
+
+    /**
+     * @brief Tag of a log category, e.g. "[ENGINE]".
+     */
     static std::string_view toString(LogCategory category) noexcept;
-    static std::string_view toColorString(LogLevel level) noexcept;
-  };
 
-/*
- * Evaluate these macros in debug configuration ONLY
- */
-#if defined(UR_DEBUG)
-  /*
-   * @brief Debugging message, used for development and troubleshooting.
-   *
-   */
-  #define UR_DEB(cat, msg, ...) \
-    cout(LogLevel::DEBUG, cat, std::format(msg, __VA_ARGS__))
+  public:
+    static inline constexpr std::string_view DEFAULT_FILE = "uranium.log";
 
-  /*
-   * @brief An error occurred. The program may need to handle this.
-   *
-   */
-  #define UR_ERROR(cat, msg, ...) \
-    cout(LogLevel::ERROR, cat, std::format(msg, __VA_ARGS__))
+    // Levels under the floor are stripped from the build, see UR_LOG_FLOOR
+    static inline constexpr LogLevel FLOOR = LogLevel::UR_LOG_FLOOR;
 
-  /*
-   * @brief Application cannot continue, must close program entirely.
-   *
-   */
-  #define UR_FATAL(cat, msg, ...) \
-    cout(LogLevel::FATAL, cat, std::format(msg, __VA_ARGS__))
+  private:
+    static constexpr uint64_t bitOf(LogLevel lvl, LogCategory cat) noexcept {
+      return uint64_t(1) << (static_cast<uint32_t>(cat) *
+                                 static_cast<uint32_t>(LogLevel::COUNT) +
+                             static_cast<uint32_t>(lvl));
+    }
 
-  /*
-   * @brief Provides information to the client through the console.
-   *
-   */
-  #define UR_INFO(cat, msg, ...) \
-    cout(LogLevel::INFO, cat, std::format(msg, __VA_ARGS__))
+    static constexpr uint64_t maskOf(LogLevel threshold) noexcept {
+      uint64_t mask = 0;
+      for (uint32_t cat = 0; cat < uint32_t(LogCategory::COUNT); ++cat) {
+        for (uint32_t lvl = 0; lvl < uint32_t(LogLevel::COUNT); ++lvl) {
+          if (severityOf(LogLevel(lvl)) >= severityOf(threshold)) {
+            mask |= bitOf(LogLevel(lvl), LogCategory(cat));
+          }
+        }
+      }
+      return mask;
+    }
 
-  /*
-   * @brief Provides detailed trace information.
-   *
-   */
-  #define UR_TRACE(cat, msg, ...) \
-    cout(LogLevel::TRACE, cat, std::format(msg, __VA_ARGS__))
+    static void write(LogLevel lvl, LogCategory cat,
+                      std::string_view msg) noexcept;
+    static std::string_view toColorString(LogLevel level) noexcept;
 
-  /*
-   * @brief A warning occurred, but the program can continue.
-   *
-   */
-  #define UR_WARN(cat, msg, ...) \
-    cout(LogLevel::WARN, cat, std::format(msg, __VA_ARGS__))
-
-#elif defined(UR_RELEASE)
-  /*
-   * @brief An error occurred. The program may need to handle this.
-   *        Writes to a log file the error.
-   *
-   */
-  #define UR_ERROR(cat, msg, ...) \
-    fout(LogLevel::ERROR, cat, std::format(msg, __VA_ARGS__))
+  private:
+    static_assert(uint32_t(LogCategory::COUNT) * uint32_t(LogLevel::COUNT) <=
+                      64,
+                  "The level mask holds one bit per category and level.");
 
-  /*
-   * @brief Application cannot continue, must close program entirely
-   *        Writes to a log file the fatal error.
-   */
-  #define UR_FATAL(cat, msg, ...) \
-    fout(LogLevel::FATAL, cat, std::format(msg, __VA_ARGS__))
+    // One bit per category and level, see setThreshold()
+    static inline std::atomic<uint64_t> levels{
+        maskOf(LogLevel::UR_LOG_DEFAULT)};
+  };
 
-  /*
-   * @brief Provides information to the client.
-   *
-   */
-  #define UR_INFO(cat, msg, ...) \
-    fout(LogLevel::INFO, cat, std::format(msg, __VA_ARGS__))
+}  // namespace uranium::core
 
-  #define UR_TRACE(cat, msg, ...) /*Nothing*/
-  #define UR_WARN(cat, msg, ...)  /*Nothing*/
+/*
+ * @brief Logging macros, used as Logger::UR_INFO(cat, msg, args...). The
+ *        arguments are only evaluated when the level is enabled for the
+ *        category. Debug builds print to the console, the others write to
+ *        the log file.
+ */
+#define UR_LOG_CALL(lvl, cat, msg, ...) \
+  log<lvl>(cat, [&] { return std::format(msg __VA_OPT__(, ) __VA_ARGS__); })
 
-#elif defined(UR_DIST)
-  /*
-   * @brief An error occurred. The program may need to handle this.
-   *        Error gets written into a log file.
-   *
-   */
-  #define UR_ERROR(cat, msg, ...) \
-    fout(LogLevel::ERROR, cat, std::format(msg, __VA_ARGS__))
+/*
+ * @brief Provides detailed trace information.
+ *
+ */
+#define UR_TRACE(cat, msg, ...) \
+  UR_LOG_CALL(LogLevel::TRACE, cat, msg __VA_OPT__(, ) __VA_ARGS__)
 
-  /*
-   * @brief Application cannot continue, must close program entirely.
-   *        Fatal error gets written into a log file.
-   *
-   */
-  #define UR_FATAL(cat, msg, ...) \
-    fout(LogLevel::FATAL, cat, std::format(msg, __VA_ARGS__))
+/*
+ * @brief Debugging message, used for development and troubleshooting.
+ *
+ */
+#define UR_DEB(cat, msg, ...) \
+  UR_LOG_CALL(LogLevel::DEBUG, cat, msg __VA_OPT__(, ) __VA_ARGS__)
+
+/*
+ * @brief Provides information to the client.
+ *
+ */
+#define UR_INFO(cat, msg, ...) \
+  UR_LOG_CALL(LogLevel::INFO, cat, msg __VA_OPT__(, ) __VA_ARGS__)
 
-  #define UR_INFO(cat, msg, ...)  /*Nothing*/
-  #define UR_TRACE(cat, msg, ...) /*Nothing*/
-  #define UR_WARN(cat, msg, ...)  /*Nothing*/
+/*
+ * @brief A warning occurred, but the program can continue.
+ *
+ */
+#define UR_WARN(cat, msg, ...) \
+  UR_LOG_CALL(LogLevel::WARN, cat, msg __VA_OPT__(, ) __VA_ARGS__)
 
-  #define UR_ASSERT(condition, cat, msg)   /*Nothing*/
-  #define UR_STATIC_ASSERT(condition, msg) /*Nothing*/
+/*
+ * @brief An error occurred. The program may need to handle this.
+ *
+ */
+#define UR_ERROR(cat, msg, ...) \
+  UR_LOG_CALL(LogLevel::ERROR, cat, msg __VA_OPT__(, ) __VA_ARGS__)
 
-#endif
-}  // namespace uranium::core
+/*
+ * @brief Application cannot continue, must close program entirely.
+ *
+ */
+#define UR_FATAL(cat, msg, ...) \
+  UR_LOG_CALL(LogLevel::FATAL, cat, msg __VA_OPT__(, ) __VA_ARGS__)
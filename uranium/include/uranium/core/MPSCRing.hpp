@@ -0,0 +1,187 @@
+/*******************************************************************
+ * @file   MPSCRing.hpp
+ * @brief  Bounded lock-free multi-producer single-consumer ring buffer.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include "Types.hpp"
+
+namespace uranium::core {
+
+  /**
+   * @class MPSCRing
+   * @brief Fixed-capacity ring that any number of threads can push into
+   *        while a single thread pops from it.
+   *
+   *        Every cell carries a sequence number telling whether it is free
+   *        for the producer lap or filled for the consumer lap. Producers
+   *        only contend on the tail cursor; the consumer owns the head and
+   *        never takes a lock.
+   *
+   * @tparam T        Element type, copied in and out of the cells.
+   * @tparam Capacity Number of cells. Must be a power of two.
+   */
+  template <typename T, size_t Capacity>
+  class MPSCRing final {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "MPSCRing capacity must be a power of two.");
+
+  public:
+    explicit MPSCRing() noexcept : head(0), tail(0) {
+      for (size_t i = 0; i < Capacity; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    MPSCRing(const MPSCRing&) = delete;
+    MPSCRing& operator=(const MPSCRing&) = delete;
+
+    /**
+     * @brief Pushes a value into the ring. Safe to call from any thread.
+     *
+     * @param value The value to copy into the ring.
+     * @return true if the value was stored.
+     * @return false if the ring is full.
+     */
+    bool tryPush(const T& value) noexcept {
+      size_t pos = tail.load(std::memory_order_relaxed);
+      for (;;) {
+        Cell& cell = cells[pos & MASK];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+          // The cell is free for this lap, try to claim it
+          if (tail.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed)) {
+            cell.value = value;
+            cell.sequence.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (diff < 0) {
+          // The consumer has not released this cell yet
+          return false;
+        } else {
+          // Another producer claimed the cell first
+          pos = tail.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /**
+     * @brief Claims a cell and lets the caller write the value in place,
+     *        avoiding a copy of large values. Safe to call from any thread.
+     *
+     * @param fill Invoked with the cell value to overwrite, must not throw.
+     * @return true if the value was stored.
+     * @return false if the ring is full, `fill` is then not invoked.
+     */
+    template <typename Fill>
+    bool tryProduce(Fill&& fill) noexcept {
+      size_t pos = tail.load(std::memory_order_relaxed);
+      for (;;) {
+        Cell& cell = cells[pos & MASK];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+          if (tail.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed)) {
+            fill(cell.value);
+            cell.sequence.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (diff < 0) {
+          return false;
+        } else {
+          pos = tail.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /**
+     * @brief Lets the consumer read the oldest value in place before its
+     *        cell is released. Must only be called by the consumer.
+     *
+     * @param consume Invoked with the oldest value.
+     * @return true if a value was consumed.
+     * @return false if the ring is empty or the next cell is still being
+     *         written by a producer.
+     */
+    template <typename Consume>
+    bool tryConsume(Consume&& consume) noexcept {
+      Cell& cell = cells[head & MASK];
+      size_t seq = cell.sequence.load(std::memory_order_acquire);
+      if (seq != head + 1) {
+        return false;
+      }
+
+      consume(static_cast<const T&>(cell.value));
+      cell.sequence.store(head + Capacity, std::memory_order_release);
+      ++head;
+      return true;
+    }
+
+    /**
+     * @brief Pops the oldest value. Must only be called by the consumer.
+     *
+     * @param out Receives the popped value.
+     * @return true if a value was popped.
+     * @return false if the ring is empty or the next cell is still being
+     *         written by a producer.
+     */
+    bool tryPop(T& out) noexcept {
+      Cell& cell = cells[head & MASK];
+      size_t seq = cell.sequence.load(std::memory_order_acquire);
+      if (seq != head + 1) {
+        return false;
+      }
+
+      out = cell.value;
+      cell.sequence.store(head + Capacity, std::memory_order_release);
+      ++head;
+      return true;
+    }
+
+    /**
+     * @brief Checks whether the oldest value is fully written and can be
+     *        popped. Must only be called by the consumer.
+     */
+    bool ready() const noexcept {
+      return cells[head & MASK].sequence.load(std::memory_order_acquire) ==
+             head + 1;
+    }
+
+    /**
+     * @brief Checks whether no producer has claimed a cell the consumer has
+     *        not popped yet. Must only be called by the consumer.
+     */
+    bool empty() const noexcept {
+      return tail.load(std::memory_order_acquire) == head;
+    }
+
+    /**
+     * @brief Maximum number of values the ring can hold at once.
+     */
+    static constexpr size_t capacity() noexcept { return Capacity; }
+
+  private:
+    static inline constexpr size_t MASK = Capacity - 1;
+
+    struct Cell {
+      std::atomic<size_t> sequence;
+      T value;
+    };
+
+    alignas(UR_CACHE_LINE) size_t head;
+    alignas(UR_CACHE_LINE) std::atomic<size_t> tail;
+    alignas(UR_CACHE_LINE) std::array<Cell, Capacity> cells;
+  };
+}  // namespace uranium::core
@@ -0,0 +1,120 @@
+/*******************************************************************
+ * @file   Profiler.hpp
+ * @brief  Scoped CPU zones exported as a Chrome trace.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Types.hpp"
+
+namespace uranium::core {
+
+  /**
+   * @class Profiler
+   * @brief Records timed zones of every thread and writes them in the
+   *        Chrome trace event format, which chrome://tracing and Perfetto
+   *        open directly.
+   *
+   *        Every thread writes its zones into its own ring, without locks
+   *        nor atomic read-modify-writes, so the rings keep the last
+   *        ZONES_PER_THREAD zones of each thread. write() may run at any
+   *        time, zones overwritten while it reads are left out.
+   *
+   *        Zones are recorded with UR_PROFILE_SCOPE, which compiles to
+   *        nothing unless UR_PROFILE is defined (URANIUM_PROFILE option).
+   */
+  class Profiler final {
+  public:
+    // Zones kept per thread, the oldest are overwritten. Power of two
+    static inline constexpr size_t ZONES_PER_THREAD = 32 * 1024;
+
+    static inline constexpr std::string_view DEFAULT_FILE =
+        "uranium.trace.json";
+
+  public:
+    /**
+     * @brief Records a zone of the calling thread.
+     *
+     * @param name  Shown in the viewer. Not copied, it must outlive the
+     *              capture, e.g. a string literal.
+     * @param begin Start time from now().
+     * @param end   End time from now().
+     *
+     * @note The first zone of a thread allocates its ring of about 768 KB,
+     *       and running out of memory there terminates. Threads that call
+     *       setThreadName() allocate it then instead.
+     */
+    static void record(const char* name, int64_t begin, int64_t end) noexcept;
+
+    /**
+     * @brief Names the calling thread in the trace, and allocates its ring
+     *        so recording never has to.
+     */
+    static void setThreadName(std::string_view name);
+
+    /**
+     * @brief Writes the zones recorded so far as Chrome trace JSON.
+     *
+     * @param path File to create or overwrite.
+     * @return false if the file could not be written.
+     */
+    static bool write(std::string_view path = DEFAULT_FILE);
+
+    /**
+     * @brief Time used by the zones, in nanoseconds.
+     */
+    static int64_t now() noexcept;
+
+    /**
+     * @brief Whether the zones are compiled into this build.
+     */
+    static constexpr bool enabled() noexcept {
+#if defined(UR_PROFILE)
+      return true;
+#else
+      return false;
+#endif
+    }
+  };
+
+  /**
+   * @class ProfileScope
+   * @brief Records a zone from its construction to its destruction.
+   */
+  class ProfileScope final {
+  public:
+    explicit ProfileScope(const char* name) noexcept
+        : name(name), begin(Profiler::now()) {}
+
+    ~ProfileScope() noexcept { Profiler::record(name, begin, Profiler::now()); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+  private:
+    const char* name;
+    int64_t begin;
+  };
+}  // namespace uranium::core
+
+#define UR_PROFILE_CONCAT_(a, b) a##b
+#define UR_PROFILE_CONCAT(a, b) UR_PROFILE_CONCAT_(a, b)
+
+/*
+ * @brief Profiles the rest of the enclosing scope.
+ *
+ * @param name - Zone name, must outlive the capture (e.g. a literal).
+ */
+#if defined(UR_PROFILE)
+  #define UR_PROFILE_SCOPE(name)                                       \
+    ::uranium::core::ProfileScope UR_PROFILE_CONCAT(ur_profile_scope_, \
+                                                    __LINE__)(name)
+#else
+  #define UR_PROFILE_SCOPE(name)
+#endif
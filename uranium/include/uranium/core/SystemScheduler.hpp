@@ -0,0 +1,199 @@
+/*******************************************************************
+ * @file   SystemScheduler.hpp
+ * @brief  Per-frame scheduler running systems as a dependency graph.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Delegate.hpp"
+#include "JobSystem.hpp"
+#include "Types.hpp"
+
+namespace uranium::core {
+
+  /**
+   * @class SystemScheduler
+   * @brief Runs the engine systems of a frame concurrently, as allowed by
+   *        the resources they declare to read or write.
+   *
+   *        Systems form a graph in registration order: a system depends on
+   *        the last earlier writer of every resource it touches, and a
+   *        writer also on the earlier readers since that writer. The graph
+   *        is built once and cached until a system is added or removed.
+   *
+   *        Every frame is timed, and report() tells the critical path: the
+   *        chain of dependent systems that bounds the frame time.
+   */
+  class SystemScheduler final {
+  public:
+    using SystemID = uint32_t;
+    using ResourceID = uint64_t;
+
+    /**
+     * @brief Receives the frame time, in seconds.
+     */
+    using Run = Delegate<void(double dt)>;
+
+    /**
+     * @struct Access
+     * @brief A resource a system reads or writes.
+     */
+    struct Access {
+      ResourceID resource;
+      bool write;
+    };
+
+    /**
+     * @struct Timing
+     * @brief Measured run of a system in the last frame.
+     */
+    struct Timing {
+      double start;     // Since the frame started, in ms
+      double duration;  // In ms
+    };
+
+    /**
+     * @struct Report
+     * @brief Timings of the last frame.
+     */
+    struct Report {
+      std::vector<Timing> systems;          // Indexed by SystemID
+      std::vector<SystemID> critical_path;  // First to last
+      double critical_time = 0.0;           // Sum of the path, in ms
+      double frame_time = 0.0;              // Wall time of run(), in ms
+    };
+
+  public:
+    explicit SystemScheduler() noexcept;
+
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    /**
+     * @brief Registers a system.
+     *
+     * @param name   Shown in the reports and the profiler. Kept until
+     *               the scheduler is destroyed.
+     * @param run    Called once per frame, from any thread.
+     * @param access Every resource the system reads or writes.
+     * @return The ID of the system.
+     */
+    SystemID add(std::string_view name, Run run,
+                 std::initializer_list<Access> access);
+
+    /**
+     * @brief Unregisters a system. Its ID is not reused.
+     */
+    void remove(SystemID id);
+
+    /**
+     * @brief Runs every system once and waits for all of them.
+     *
+     * @param jobs Job system the systems run on.
+     * @param dt   Frame time passed to the systems, in seconds.
+     */
+    void run(JobSystem& jobs, double dt);
+
+    /**
+     * @brief Timings and critical path of the last run().
+     */
+    const Report& report() const noexcept;
+
+    /**
+     * @brief Name of a system.
+     */
+    std::string_view nameOf(SystemID id) const;
+
+    /**
+     * @brief Logs the critical path of the last run().
+     */
+    void logCriticalPath() const;
+
+    /**
+     * @brief A named resource, e.g. reads("Transforms").
+     */
+    static constexpr Access reads(std::string_view name) noexcept {
+      return Access{resourceOf(name), false};
+    }
+
+    static constexpr Access writes(std::string_view name) noexcept {
+      return Access{resourceOf(name), true};
+    }
+
+    /**
+     * @brief A resource named by a type, e.g. writes<Transform>().
+     */
+    template <typename T>
+    static Access reads() noexcept {
+      return Access{resourceOf<T>(), false};
+    }
+
+    template <typename T>
+    static Access writes() noexcept {
+      return Access{resourceOf<T>(), true};
+    }
+
+  private:
+    /**
+     * @struct System
+     * @brief A registered system and its place in the graph.
+     */
+    struct System {
+      const char* name;  // Into names, never moves
+      Run run;
+      std::vector<Access> access;
+      bool alive;
+
+      std::vector<SystemID> dependencies;
+      std::vector<SystemID> dependents;
+    };
+
+    void build();
+    void launch(SystemID id);
+    void execute(SystemID id);
+    void findCriticalPath();
+
+    // FNV-1a, with the top bit clear so it never matches a type
+    static constexpr ResourceID resourceOf(std::string_view name) noexcept {
+      ResourceID hash = 0xCBF29CE484222325ull;
+      for (char c : name) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3ull;
+      }
+      return hash >> 1;
+    }
+
+    // The address of a per-type variable, with the top bit set
+    template <typename T>
+    static ResourceID resourceOf() noexcept {
+      static const char tag = 0;
+      return reinterpret_cast<uintptr_t>(&tag) | (ResourceID(1) << 63);
+    }
+
+  private:
+    std::vector<System> systems;
+    bool dirty;
+
+    // The profiler keeps the zone names until it writes the trace, a deque
+    // keeps them in place as systems are added
+    std::deque<std::string> names;
+
+    // State of the frame being run
+    std::unique_ptr<std::atomic<uint32_t>[]> remaining;
+    JobSystem* jobs;
+    JobCounter* frame;
+    double dt;
+    int64_t frame_start;
+
+    Report last;
+  };
+}  // namespace uranium::core
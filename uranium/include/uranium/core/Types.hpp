@@ -22,4 +22,7 @@
 #define UR_EXTENDS public          // Inheritance specifier
 #define UR_IMPLEMENTS public       // Interface implementation specifier
 
+// Size used to keep independently written atomics on separate cache lines
+#define UR_CACHE_LINE 64
+
 using byte = int8_t;
@@ -78,7 +78,7 @@
   #define UR_ON_DEBUG(statement)
   #define UR_ON_DEBUG_SWAP(debug_statement, release_statement) release_statement
 
-  #define UR_ASSERT(condition, type, message)
+  #define UR_ASSERT(condition)
   #define UR_STATIC_ASSERT(condition, message)
 #endif
 
@@ -0,0 +1,122 @@
+/*******************************************************************
+ * @file   WorkStealingDeque.hpp
+ * @brief  Bounded Chase-Lev work-stealing deque.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Types.hpp"
+
+namespace uranium::core {
+
+  /**
+   * @class WorkStealingDeque
+   * @brief Deque of pointers owned by one thread, which pushes and pops at
+   *        the bottom (LIFO, cache-warm), while any other thread steals
+   *        from the top (FIFO, the oldest and usually largest work).
+   *
+   *        Follows Chase and Lev, with the memory orders of Le et al.,
+   *        "Correct and Efficient Work-Stealing for Weak Memory Models".
+   *        The owner only contends with thieves over the last element.
+   *
+   * @tparam T        Pointed-to element type.
+   * @tparam Capacity Number of cells. Must be a power of two.
+   */
+  template <typename T, size_t Capacity>
+  class WorkStealingDeque final {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "WorkStealingDeque capacity must be a power of two.");
+
+  public:
+    explicit WorkStealingDeque() noexcept : top(0), bottom(0), cells() {}
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Pushes an element at the bottom. Owner thread only.
+     *
+     * @return false if the deque is full.
+     */
+    bool push(T* value) noexcept {
+      int64_t b = bottom.load(std::memory_order_relaxed);
+      int64_t t = top.load(std::memory_order_acquire);
+      if (b - t >= static_cast<int64_t>(Capacity)) {
+        return false;
+      }
+      cells[b & MASK].store(value, std::memory_order_relaxed);
+      bottom.store(b + 1, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * @brief Pops the element pushed last. Owner thread only.
+     *
+     * @return The element, or nullptr if the deque is empty.
+     */
+    T* pop() noexcept {
+      int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+      bottom.store(b, std::memory_order_seq_cst);
+      int64_t t = top.load(std::memory_order_seq_cst);
+
+      if (t > b) {
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+      }
+
+      T* value = cells[b & MASK].load(std::memory_order_relaxed);
+      if (t == b) {
+        // Last element, race the thieves for it
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+          value = nullptr;
+        }
+        bottom.store(b + 1, std::memory_order_relaxed);
+      }
+      return value;
+    }
+
+    /**
+     * @brief Steals the oldest element. Safe from any thread.
+     *
+     * @return The element, or nullptr if the deque was empty or another
+     *         thread won the race for it.
+     */
+    T* steal() noexcept {
+      int64_t t = top.load(std::memory_order_seq_cst);
+      int64_t b = bottom.load(std::memory_order_seq_cst);
+      if (t >= b) {
+        return nullptr;
+      }
+
+      T* value = cells[t & MASK].load(std::memory_order_relaxed);
+      if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+        return nullptr;
+      }
+      return value;
+    }
+
+    /**
+     * @brief Checks if the deque looks empty. Only a hint from other threads.
+     */
+    bool empty() const noexcept {
+      return bottom.load(std::memory_order_seq_cst) <=
+             top.load(std::memory_order_seq_cst);
+    }
+
+  private:
+    static inline constexpr size_t MASK = Capacity - 1;
+
+    alignas(UR_CACHE_LINE) std::atomic<int64_t> top;
+    alignas(UR_CACHE_LINE) std::atomic<int64_t> bottom;
+    alignas(UR_CACHE_LINE) std::array<std::atomic<T*>, Capacity> cells;
+  };
+}  // namespace uranium::core
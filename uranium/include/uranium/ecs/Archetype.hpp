@@ -0,0 +1,141 @@
+/*******************************************************************
+ * @file   Archetype.hpp
+ * @brief  Table of the entities sharing one set of components.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+#include "Component.hpp"
+#include "Entity.hpp"
+#include "uranium/memory/PoolAllocator.hpp"
+
+namespace uranium::ecs {
+
+  /**
+   * @class Archetype
+   * @brief Stores every entity with exactly one signature, in chunks of
+   *        CHUNK_SIZE bytes. A chunk holds the handles of its entities and
+   *        one array per component, each starting on a cache line:
+   *
+   *          [Entity x capacity][A x capacity][B x capacity]...
+   *
+   *        Rows are packed, every chunk is full but the last one. Removing
+   *        a row moves the last row into it, so rows are not stable; the
+   *        world tracks the row of every entity.
+   */
+  class Archetype final {
+  public:
+    static inline constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+    /**
+     * @struct Chunk
+     * @brief A block of CHUNK_SIZE bytes and its number of rows in use.
+     */
+    struct Chunk {
+      std::byte* data = nullptr;
+      uint32_t count = 0;
+    };
+
+  public:
+    /**
+     * @brief Lays the chunks out for a signature.
+     *
+     * @param signature Components of the entities.
+     * @param allocator Pool of CHUNK_SIZE blocks the chunks come from.
+     */
+    explicit Archetype(const Signature& signature,
+                       memory::PoolAllocator& allocator);
+
+    /**
+     * @brief Destroys every component and returns the chunks.
+     */
+    ~Archetype() noexcept;
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    const Signature& signature() const noexcept { return types; }
+
+    bool has(ComponentId id) const noexcept { return types.test(id); }
+
+    /**
+     * @brief Number of entities.
+     */
+    uint32_t size() const noexcept { return rows; }
+
+    /**
+     * @brief Rows per chunk.
+     */
+    uint32_t capacity() const noexcept { return chunk_capacity; }
+
+    size_t chunkCount() const noexcept { return chunks.size(); }
+    const Chunk& chunk(size_t index) const noexcept { return chunks[index]; }
+
+    Entity* entities(size_t chunk) const noexcept {
+      return reinterpret_cast<Entity*>(chunks[chunk].data);
+    }
+
+    /**
+     * @brief Array of a component in a chunk, the archetype must have it.
+     */
+    void* column(size_t chunk, ComponentId id) const noexcept {
+      return chunks[chunk].data + offsets[columns[id]];
+    }
+
+    template <typename T>
+    T* column(size_t chunk) const noexcept {
+      return static_cast<T*>(column(chunk, ComponentRegistry::id<T>()));
+    }
+
+    /**
+     * @brief A component of a row, the archetype must have it.
+     */
+    void* component(uint32_t row, ComponentId id) const noexcept {
+      uint32_t index = row % chunk_capacity;
+      return static_cast<std::byte*>(column(row / chunk_capacity, id)) +
+             index * ComponentRegistry::info(id).size;
+    }
+
+    /**
+     * @brief Appends a row for an entity, its components unconstructed.
+     *
+     * @return The row.
+     */
+    uint32_t push(Entity entity);
+
+    /**
+     * @brief Removes a row by moving the last row into it.
+     *
+     * @param row         Row to remove.
+     * @param constructed Whether the components of the row are still
+     *                    constructed and must be destroyed first.
+     * @return The entity moved into the row, NO_ENTITY if it was the last.
+     */
+    Entity erase(uint32_t row, bool constructed) noexcept;
+
+  private:
+    friend class World;
+
+    static inline constexpr uint16_t NO_COLUMN = UINT16_MAX;
+
+    Signature types;
+    std::vector<ComponentId> ids;    // Components in id order
+    std::vector<size_t> offsets;     // Of each array in a chunk
+    std::array<uint16_t, MAX_COMPONENTS> columns;  // Id to index in ids
+
+    uint32_t chunk_capacity;
+    uint32_t rows;
+    std::vector<Chunk> chunks;
+    memory::PoolAllocator& pool;
+
+    // Archetypes one component away, filled as the world finds them
+    std::unordered_map<ComponentId, Archetype*> with;
+    std::unordered_map<ComponentId, Archetype*> without;
+  };
+}  // namespace uranium::ecs
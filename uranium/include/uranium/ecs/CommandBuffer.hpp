@@ -0,0 +1,107 @@
+/*******************************************************************
+ * @file   CommandBuffer.hpp
+ * @brief  Structural changes recorded now and applied to a world later.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "Component.hpp"
+#include "Entity.hpp"
+#include "uranium/memory/LinearAllocator.hpp"
+
+namespace uranium::ecs {
+
+  /**
+   * @class CommandBuffer
+   * @brief Records entity creations, destructions and component changes
+   *        while queries iterate, for World::apply() to run afterwards in
+   *        the same order. Recording never touches the world, so every job
+   *        of a parallel query can fill its own buffer.
+   *
+   *        Components added are moved into a bump allocator owned by the
+   *        buffer, and moved again into their chunk when applied.
+   */
+  class CommandBuffer final {
+  public:
+    static inline constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+  public:
+    /**
+     * @param capacity Bytes of components recorded before spilling to the
+     *                 heap, the buffer grows to its peak on clear().
+     */
+    explicit CommandBuffer(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Destroys the components of the commands never applied.
+     */
+    ~CommandBuffer() noexcept;
+
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    /**
+     * @brief Records the creation of an entity.
+     *
+     * @return A handle valid for the other commands of this buffer only,
+     *         replaced by the real entity when the buffer is applied.
+     */
+    Entity create();
+
+    void destroy(Entity entity);
+
+    /**
+     * @brief Records adding a component, or replacing the entity's one.
+     */
+    template <typename T>
+    void add(Entity entity, T&& component) {
+      using Component = std::remove_cvref_t<T>;
+      void* payload = payloads.allocate(sizeof(Component), alignof(Component),
+                                        memory::Tag::ENGINE);
+      ::new (payload) Component(std::forward<T>(component));
+      commands.push_back({Operation::ADD, ComponentRegistry::id<Component>(),
+                          entity, payload});
+    }
+
+    template <typename T>
+    void remove(Entity entity) {
+      commands.push_back(
+          {Operation::REMOVE, ComponentRegistry::id<T>(), entity, nullptr});
+    }
+
+    bool empty() const noexcept { return commands.empty(); }
+    size_t size() const noexcept { return commands.size(); }
+
+    /**
+     * @brief Drops every command without applying it.
+     */
+    void clear() noexcept;
+
+  private:
+    friend class World;
+
+    enum class Operation : uint8_t { CREATE, DESTROY, ADD, REMOVE };
+
+    /**
+     * @struct Command
+     * @brief A recorded change. The payload of ADD is the component to
+     *        move in, nulled once the world consumed it.
+     */
+    struct Command {
+      Operation operation;
+      ComponentId component;
+      Entity entity;
+      void* payload;
+    };
+
+    std::vector<Command> commands;
+    memory::LinearAllocator payloads;
+    uint32_t created;
+  };
+}  // namespace uranium::ecs
@@ -0,0 +1,136 @@
+/*******************************************************************
+ * @file   Component.hpp
+ * @brief  Runtime identifiers and layouts of component types.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "uranium/core/Types.hpp"
+
+namespace uranium::ecs {
+
+  using ComponentId = uint16_t;
+
+  // Component types a program may register
+  static inline constexpr size_t MAX_COMPONENTS = 128;
+
+  /**
+   * @brief Set of component types, one bit per ComponentId.
+   */
+  using Signature = std::bitset<MAX_COMPONENTS>;
+
+  /**
+   * @struct ComponentInfo
+   * @brief What the storage needs to know of a component type. The
+   *        functions are null for trivial types, which are copied with
+   *        memcpy and need no destruction.
+   */
+  struct ComponentInfo {
+    using MoveFn = void (*)(void* dst, void* src) noexcept;
+    using DestroyFn = void (*)(void* ptr) noexcept;
+
+    size_t size = 0;
+    size_t alignment = 0;
+    MoveFn move_fn = nullptr;
+    DestroyFn destroy_fn = nullptr;
+
+    /**
+     * @brief Move-constructs dst from src, src is left to be destroyed.
+     */
+    void move(void* dst, void* src) const noexcept {
+      if (move_fn) {
+        move_fn(dst, src);
+      } else {
+        std::memcpy(dst, src, size);
+      }
+    }
+
+    void destroy(void* ptr) const noexcept {
+      if (destroy_fn) {
+        destroy_fn(ptr);
+      }
+    }
+  };
+
+  /**
+   * @class ComponentRegistry
+   * @brief Gives every component type a dense id on its first use, from
+   *        any thread. Ids depend on the order of first use, so they must
+   *        not be saved.
+   */
+  class ComponentRegistry final {
+  public:
+    ComponentRegistry() = delete;
+
+    /**
+     * @brief Id of a component type, registering it on the first call.
+     */
+    template <typename T>
+    static ComponentId id() {
+      using Type = std::remove_cvref_t<T>;
+      if constexpr (!std::is_same_v<T, Type>) {
+        // One registration per type, whatever its qualifiers
+        return id<Type>();
+      } else {
+        static_assert(std::is_nothrow_move_constructible_v<Type>,
+                      "Components are moved between chunks and must not "
+                      "throw when moved.");
+        static_assert(alignof(Type) <= UR_CACHE_LINE,
+                      "Chunks are only aligned to a cache line.");
+        static const ComponentId value = enroll(describe<Type>());
+        return value;
+      }
+    }
+
+    /**
+     * @brief Layout of a registered component type.
+     */
+    static const ComponentInfo& info(ComponentId id) noexcept;
+
+    /**
+     * @brief Number of component types registered so far.
+     */
+    static size_t count() noexcept;
+
+  private:
+    template <typename T>
+    static ComponentInfo describe() noexcept {
+      ComponentInfo info;
+      info.size = sizeof(T);
+      info.alignment = alignof(T);
+      if constexpr (!std::is_trivially_copyable_v<T>) {
+        info.move_fn = [](void* dst, void* src) noexcept {
+          ::new (dst) T(std::move(*static_cast<T*>(src)));
+        };
+      }
+      if constexpr (!std::is_trivially_destructible_v<T>) {
+        info.destroy_fn = [](void* ptr) noexcept {
+          static_cast<T*>(ptr)->~T();
+        };
+      }
+      return info;
+    }
+
+    static ComponentId enroll(const ComponentInfo& info);
+  };
+
+  /**
+   * @brief Signature of a list of component types.
+   */
+  template <typename... Components>
+  Signature signatureOf() {
+    Signature signature;
+    (signature.set(ComponentRegistry::id<Components>()), ...);
+    return signature;
+  }
+}  // namespace uranium::ecs
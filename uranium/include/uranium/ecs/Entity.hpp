@@ -0,0 +1,44 @@
+/*******************************************************************
+ * @file   Entity.hpp
+ * @brief  Generational handle of an entity.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "uranium/core/Types.hpp"
+
+namespace uranium::ecs {
+
+  /**
+   * @struct Entity
+   * @brief Index of a slot of the world and the generation of that slot
+   *        when the entity was created. Destroying an entity bumps the
+   *        generation, so stale handles are detected instead of reaching
+   *        whichever entity reuses the slot.
+   */
+  struct Entity {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = UINT32_MAX;
+
+    constexpr bool operator==(const Entity&) const noexcept = default;
+  };
+
+  // Handle of no entity
+  static inline constexpr Entity NO_ENTITY = Entity();
+
+  // Generation of the entities a CommandBuffer creates, until it is applied
+  static inline constexpr uint32_t PENDING_GENERATION = UINT32_MAX - 1;
+}  // namespace uranium::ecs
+
+template <>
+struct std::hash<uranium::ecs::Entity> {
+  size_t operator()(const uranium::ecs::Entity& entity) const noexcept {
+    return std::hash<uint64_t>()(
+        (static_cast<uint64_t>(entity.generation) << 32) | entity.index);
+  }
+};
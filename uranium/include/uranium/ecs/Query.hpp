@@ -0,0 +1,145 @@
+/*******************************************************************
+ * @file   Query.hpp
+ * @brief  Chunk-wise iteration over the entities with some components.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "World.hpp"
+#include "uranium/core/JobSystem.hpp"
+
+namespace uranium::ecs {
+
+  /**
+   * @class Query
+   * @brief Visits every entity having all the listed components, whatever
+   *        else it has. The visit is chunk by chunk: the callback gets the
+   *        arrays of a chunk, so its inner loop runs over contiguous
+   *        memory and can vectorize. Mark read-only components const.
+   *
+   *        The matching archetypes are cached and only the archetypes
+   *        created since the last visit are tested, so keep queries alive
+   *        across frames instead of building them every time.
+   *
+   * @tparam Components Components to visit.
+   */
+  template <typename... Components>
+  class Query final {
+  public:
+    explicit Query(World& world)
+        : world(&world),
+          required(signatureOf<Components...>()),
+          matched(),
+          seen(0) {}
+
+    /**
+     * @brief Calls f(size_t count, const Entity* entities, Components*...
+     *        arrays) for every non-empty chunk.
+     */
+    template <typename F>
+    void eachChunk(F&& f) {
+      refresh();
+      Iteration iteration(*world);
+      for (Archetype* archetype : matched) {
+        for (size_t c = 0; c < archetype->chunkCount(); ++c) {
+          visit(*archetype, c, f);
+        }
+      }
+    }
+
+    /**
+     * @brief Same as eachChunk() with the chunks spread over the jobs, f
+     *        is called concurrently and must record structural changes
+     *        into a command buffer of its own thread.
+     */
+    template <typename F>
+    void eachChunk(core::JobSystem& jobs, F&& f) {
+      refresh();
+      std::vector<std::pair<Archetype*, size_t>> work;
+      for (Archetype* archetype : matched) {
+        for (size_t c = 0; c < archetype->chunkCount(); ++c) {
+          work.emplace_back(archetype, c);
+        }
+      }
+
+      Iteration iteration(*world);
+      jobs.parallelFor(work.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          visit(*work[i].first, work[i].second, f);
+        }
+      });
+    }
+
+    /**
+     * @brief Calls f(Components&...) or f(Entity, Components&...) for
+     *        every entity.
+     */
+    template <typename F>
+    void each(F&& f) {
+      eachChunk([&](size_t count, const Entity* entities,
+                    Components*... arrays) {
+        for (size_t i = 0; i < count; ++i) {
+          if constexpr (std::is_invocable_v<F&, Entity, Components&...>) {
+            f(entities[i], arrays[i]...);
+          } else {
+            f(arrays[i]...);
+          }
+        }
+      });
+    }
+
+    /**
+     * @brief Number of entities matching.
+     */
+    size_t count() {
+      refresh();
+      size_t entities = 0;
+      for (const Archetype* archetype : matched) {
+        entities += archetype->size();
+      }
+      return entities;
+    }
+
+  private:
+    /**
+     * @struct Iteration
+     * @brief Refuses structural changes to the world while it lives.
+     */
+    struct Iteration {
+      World& world;
+      explicit Iteration(World& world) noexcept : world(world) {
+        ++world.iterating;
+      }
+      ~Iteration() noexcept { --world.iterating; }
+    };
+
+    void refresh() {
+      for (; seen < world->archetypes.size(); ++seen) {
+        Archetype* archetype = world->archetypes[seen].get();
+        if ((archetype->signature() & required) == required) {
+          matched.push_back(archetype);
+        }
+      }
+    }
+
+    template <typename F>
+    static void visit(const Archetype& archetype, size_t chunk, F& f) {
+      f(static_cast<size_t>(archetype.chunk(chunk).count),
+        static_cast<const Entity*>(archetype.entities(chunk)),
+        archetype.template column<std::remove_const_t<Components>>(
+            chunk)...);
+    }
+
+  private:
+    World* world;
+    Signature required;
+    std::vector<Archetype*> matched;
+    size_t seen;
+  };
+}  // namespace uranium::ecs
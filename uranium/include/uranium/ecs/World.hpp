@@ -0,0 +1,204 @@
+/*******************************************************************
+ * @file   World.hpp
+ * @brief  Entities, their components and the archetypes storing them.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Archetype.hpp"
+#include "CommandBuffer.hpp"
+
+namespace uranium::ecs {
+
+  template <typename... Components>
+  class Query;
+
+  /**
+   * @class World
+   * @brief Owns every entity. Entities with the same set of components
+   *        share an archetype, adding or removing a component moves the
+   *        entity to the archetype of its new set.
+   *
+   *        Structural changes (creating, destroying, adding or removing
+   *        components) move rows around, so they are refused while a
+   *        query iterates: record them in a CommandBuffer and apply it
+   *        afterwards. Not thread-safe, queries may run chunks in parallel
+   *        as long as every job records into its own command buffer.
+   */
+  class World final {
+  public:
+    // Chunks added to the pool each time it runs out
+    static inline constexpr size_t CHUNKS_PER_SLAB = 64;
+
+  public:
+    explicit World();
+    ~World() noexcept;
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    /**
+     * @brief Creates an entity without components.
+     */
+    Entity create();
+
+    /**
+     * @brief Creates an entity with its components, straight into their
+     *        archetype.
+     */
+    template <typename... Components>
+    Entity create(Components&&... components);
+
+    /**
+     * @brief Destroys an entity and its components, stale handles are
+     *        ignored.
+     */
+    void destroy(Entity entity);
+
+    /**
+     * @brief Checks if the handle refers to a living entity.
+     */
+    bool alive(Entity entity) const noexcept;
+
+    /**
+     * @brief Adds a component, or replaces the one the entity has.
+     */
+    template <typename T>
+    void add(Entity entity, T&& component);
+
+    /**
+     * @brief Removes a component, if the entity has it.
+     */
+    template <typename T>
+    void remove(Entity entity);
+
+    /**
+     * @brief A component of an entity, valid until the next structural
+     *        change.
+     *
+     * @return nullptr if the entity is dead or does not have it.
+     */
+    template <typename T>
+    T* get(Entity entity) const noexcept;
+
+    template <typename T>
+    bool has(Entity entity) const noexcept;
+
+    /**
+     * @brief Runs the commands of a buffer in the order recorded, then
+     *        clears it. Commands on dead entities are skipped.
+     */
+    void apply(CommandBuffer& commands);
+
+    /**
+     * @brief Number of living entities.
+     */
+    size_t size() const noexcept { return living; }
+
+    /**
+     * @brief Number of archetypes created so far, they are never removed.
+     */
+    size_t archetypeCount() const noexcept { return archetypes.size(); }
+
+  private:
+    template <typename... Components>
+    friend class Query;
+
+    /**
+     * @struct Slot
+     * @brief Where the entity of an index lives, and its generation.
+     */
+    struct Slot {
+      uint32_t generation = 0;
+      uint32_t row = 0;
+      Archetype* archetype = nullptr;
+    };
+
+    Archetype& archetypeOf(const Signature& signature);
+
+    // Row of a new entity in the archetype of the signature, with its
+    // components unconstructed. Counts the types to catch duplicates
+    Entity spawn(const Signature& signature, size_t types);
+
+    // Moves the row of an entity to another archetype, the components
+    // the destination lacks are destroyed, the ones it adds are left
+    // unconstructed
+    void move(Slot& slot, Archetype& to);
+
+    // Storage of a component of a living entity, moving it to the
+    // archetype with the component first. Unconstructed when added
+    std::pair<void*, bool> emplace(Entity entity, ComponentId id);
+    void erase(Entity entity, ComponentId id);
+    void* find(Entity entity, ComponentId id) const noexcept;
+
+    bool structural(const char* operation) const noexcept;
+
+  private:
+    // Declared first, the archetypes return their chunks to it
+    memory::PoolAllocator chunks;
+
+    std::vector<std::unique_ptr<Archetype>> archetypes;
+    std::unordered_map<Signature, Archetype*> by_signature;
+    Archetype* empty;
+
+    std::vector<Slot> slots;
+    std::vector<uint32_t> free_slots;
+    size_t living;
+
+    // Queries currently iterating, structural changes are refused
+    uint32_t iterating;
+  };
+
+  template <typename... Components>
+  Entity World::create(Components&&... components) {
+    Entity entity =
+        spawn(signatureOf<Components...>(), sizeof...(Components));
+    if (entity == NO_ENTITY) {
+      return entity;
+    }
+    const Slot& slot = slots[entity.index];
+    (::new (slot.archetype->component(slot.row,
+                                      ComponentRegistry::id<Components>()))
+         std::remove_cvref_t<Components>(
+             std::forward<Components>(components)),
+     ...);
+    return entity;
+  }
+
+  template <typename T>
+  void World::add(Entity entity, T&& component) {
+    using Type = std::remove_cvref_t<T>;
+    auto [storage, constructed] =
+        emplace(entity, ComponentRegistry::id<Type>());
+    if (!storage) {
+      return;
+    }
+    if (constructed) {
+      *static_cast<Type*>(storage) = std::forward<T>(component);
+    } else {
+      ::new (storage) Type(std::forward<T>(component));
+    }
+  }
+
+  template <typename T>
+  void World::remove(Entity entity) {
+    erase(entity, ComponentRegistry::id<T>());
+  }
+
+  template <typename T>
+  T* World::get(Entity entity) const noexcept {
+    return static_cast<T*>(find(entity, ComponentRegistry::id<T>()));
+  }
+
+  template <typename T>
+  bool World::has(Entity entity) const noexcept {
+    return find(entity, ComponentRegistry::id<T>()) != nullptr;
+  }
+}  // namespace uranium::ecs
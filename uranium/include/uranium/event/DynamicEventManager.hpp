@@ -7,12 +7,23 @@
  *******************************************************************/
 #pragma once
 
-#include <functional>
-#include <queue>
-#include <unordered_map>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "EventArena.hpp"
+#include "EventCoalescer.hpp"
+#include "EventQueue.hpp"
+#include "EventTrace.hpp"
 #include "IEvent.hpp"
+#include "ListenerTable.hpp"
+#include "TimerWheel.hpp"
+#include "uranium/core/Delegate.hpp"
+#include "uranium/core/JobSystem.hpp"
 #include "uranium/core/Types.hpp"
 
 namespace uranium::event {
@@ -23,7 +34,13 @@ namespace uranium::event {
    *        and dispatching of those events based on priority.
    *
    *        Events are organized by priority and can be dispatched
-   *        selectively or flushed entirely.
+   *        selectively or flushed entirely. Listeners live in a flat table
+   *        indexed by event type, and are stored in delegates that never
+   *        allocate.
+   *
+   *        Each priority is also a stage of dispatchParallel(), which runs
+   *        the listeners declared thread-safe on worker threads, and only
+   *        starts a stage once the stages it depends on are done.
    */
   class DynamicEventManager final {
   public:
@@ -42,8 +59,30 @@ namespace uranium::event {
     };
 
   public:
-    using ListenerID = uint64_t;
-    using Listener = std::function<void(IEvent&)>;
+    using ListenerID = ListenerTable::Handle;
+    using Listener = ListenerTable::Listener;
+    using Concurrency = ListenerTable::Concurrency;
+    using TimerID = TimerWheel::TimerID;
+    using Duration = std::chrono::nanoseconds;
+
+    /**
+     * @brief Runs the task indices in [begin, end).
+     */
+    using RangeTask = core::Delegate<void(size_t begin, size_t end)>;
+
+    /**
+     * @brief Splits `count` task indices over worker threads, and only
+     *        returns once every one of them has run. Provided by the caller
+     *        of dispatchParallel(), so the manager does not own any thread.
+     */
+    using ParallelFor =
+        core::Delegate<void(size_t count, const RangeTask& task)>;
+
+    /**
+     * @brief Resolution of the timers, delays are rounded up to it.
+     */
+    static inline constexpr Duration TIMER_RESOLUTION =
+        std::chrono::milliseconds(1);
 
   public:
     /**
@@ -60,24 +99,30 @@ namespace uranium::event {
     /**
      * @brief Registers a new listener for a specific event type.
      *
-     * @param type     The event type to listen for.
-     * @param listener The callback function to invoke on dispatch.
+     * @param type        The event type to listen for.
+     * @param listener    The callback function to invoke on dispatch.
+     * @param concurrency THREAD_SAFE lets dispatchParallel() invoke the
+     *                    listener from a worker thread.
      * @return ListenerID A unique ID used for listener removal.
      */
-    ListenerID add(IEvent::Type type, Listener listener);
+    ListenerID add(IEvent::Type type, Listener listener,
+                   Concurrency concurrency = Concurrency::MAIN_THREAD);
 
     /**
      * @brief Registers a new listener for a specific event type.
      *        This Listener CANNOT be removed once added. The manager
      *        handles its lifetime throught the lifetime of the application.
      *
-     * @param type     The event type to listen for.
-     * @param listener The callback function to invoke on dispatch.
+     * @param type        The event type to listen for.
+     * @param listener    The callback function to invoke on dispatch.
+     * @param concurrency THREAD_SAFE lets dispatchParallel() invoke the
+     *                    listener from a worker thread.
      */
-    void addPermanent(IEvent::Type type, Listener listener);
+    void addPermanent(IEvent::Type type, Listener listener,
+                      Concurrency concurrency = Concurrency::MAIN_THREAD);
 
     /**
-     * @brief Unregisters a previously added listener.
+     * @brief Unregisters a previously added listener in constant time.
      *
      * @param type The event type associated with the listener.
      * @param id   The unique ID of the listener.
@@ -87,7 +132,31 @@ namespace uranium::event {
     bool remove(IEvent::Type type, ListenerID id);
 
     /**
-     * @brief Queues a new event under a specified priority.
+     * @brief Registers a listener for every event sharing a category with
+     *        the mask, e.g. IEvent::INPUT | IEvent::WINDOW. Category
+     *        listeners are invoked after the listeners of the event type,
+     *        always on the dispatching thread.
+     *
+     * @param categories The categories to listen for.
+     * @param listener   The callback function to invoke on dispatch.
+     * @return ListenerID A unique ID used for listener removal.
+     */
+    ListenerID addCategory(IEvent::CategoryMask categories, Listener listener);
+
+    /**
+     * @brief Unregisters a previously added category listener.
+     *
+     * @param id The unique ID of the listener.
+     * @return true if the listener was removed successfully.
+     * @return false if the listener was not found.
+     */
+    bool removeCategory(ListenerID id);
+
+    /**
+     * @brief Queues a new event under a specified priority. The caller keeps
+     *        ownership of the event and must keep it alive until it has been
+     *        dispatched or flushed. Safe to call from thread-safe listeners.
+     *        The event is dropped if the queue is full, see EventQueue.
      *
      * @param priority The priority level of the event.
      * @param event    A pointer to the event object.
@@ -95,37 +164,204 @@ namespace uranium::event {
     void raise(Priority priority, IEvent* event);
 
     /**
-     * @brief Dispatches and processes all events in a given priority queue.
+     * @brief Constructs an event in the frame arena and queues it under a
+     *        specified priority. The event is owned by the manager and is
+     *        destroyed by the second endFrame() after it was raised, so it
+     *        must be dispatched by then.
+     *
+     * @param priority The priority level of the event.
+     * @param args     Arguments forwarded to the constructor of T.
+     */
+    template <typename T, typename... Args>
+    void raise(Priority priority, Args&&... args) {
+      static_assert(std::is_base_of_v<IEvent, T>,
+                    "Raised events must derive from IEvent.");
+      raise(priority, arena.create<T>(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Queues an event under a specified priority once the delay has
+     *        elapsed. Time only moves forward through update().
+     *
+     * @param delay    Time to wait before raising the event.
+     * @param priority The priority level of the event.
+     * @param event    A pointer to the event object. The caller keeps
+     *                 ownership and must keep it alive until it is raised
+     *                 and dispatched, or the timer is cancelled.
+     * @return TimerID A handle used to cancel the timer.
+     */
+    TimerID raiseAfter(Duration delay, Priority priority, IEvent* event);
+
+    /**
+     * @brief Queues an event under a specified priority every time the
+     *        period elapses, until the timer is cancelled.
+     *
+     * @param period   Time between two raises of the event.
+     * @param priority The priority level of the event.
+     * @param event    A pointer to the event object. The caller keeps
+     *                 ownership and must keep it alive until the timer is
+     *                 cancelled.
+     * @return TimerID A handle used to cancel the timer.
+     */
+    TimerID raiseEvery(Duration period, Priority priority, IEvent* event);
+
+    /**
+     * @brief Cancels a pending delayed or periodic event.
+     *
+     * @param id The handle returned by raiseAfter() or raiseEvery().
+     * @return true if the timer was cancelled.
+     * @return false if it already fired or the handle is unknown.
+     */
+    bool cancel(TimerID id);
+
+    /**
+     * @brief Advances the timers, queuing the events of every timer that
+     *        expires. Called once per frame before dispatching.
+     *
+     * @param elapsed Time elapsed since the previous update.
+     */
+    void update(Duration elapsed);
+
+    /**
+     * @brief Coalesces the events of a type queued in the same priority
+     *        between two dispatches, so listeners see a single merged event
+     *        per dispatch. Merged events are delivered after the other
+     *        queued events.
+     *
+     * @param type    The event type to coalesce, e.g. CURSOR_MOVED.
+     * @param reducer How to merge two occurrences, for example
+     *                EventCoalescer::sum<&Event::dx, &Event::dy>(). When
+     *                empty, the last occurrence wins.
+     */
+    void coalesce(IEvent::Type type, EventCoalescer::Reducer reducer = nullptr);
+
+    /**
+     * @brief Delivers every event of a type again, undoing coalesce().
+     *
+     * @param type The event type to stop coalescing.
+     */
+    void stopCoalescing(IEvent::Type type);
+
+    /**
+     * @brief Dispatches and processes all events in a given priority queue,
+     *        in the order they were raised.
      *
      * @param priority The priority level to dispatch from.
      */
     void dispatch(Priority priority);
 
     /**
-     * @brief Clears all queued events from every priority level.
+     * @brief Declares the stages a priority stage depends on. In
+     *        dispatchParallel(), none of its listeners runs before every
+     *        listener of those stages has returned. Stages depend on nothing
+     *        by default.
+     *
+     * @param stage        The dependent priority stage.
+     * @param dependencies The stages that must be dispatched first.
+     */
+    void setDependencies(Priority stage,
+                         std::initializer_list<Priority> dependencies);
+
+    /**
+     * @brief Dispatches every priority queue, running the thread-safe
+     *        listeners of independent stages concurrently.
+     *
+     *        Stages are dispatched in waves: a wave holds every stage whose
+     *        dependencies are done. Within a wave, each thread-safe listener
+     *        gets all the events of its type in a single job, by stage and
+     *        then in the order they were raised, and may run concurrently
+     *        with any other listener, itself included for a different event
+     *        type. Once they are done, the main-thread listeners of the wave
+     *        run on the calling thread, in stage order. Events raised
+     *        meanwhile are dispatched in another pass. Thread-safe
+     *        listeners must not add or remove listeners.
+     *
+     * @param parallel_for Fans the listeners out to worker threads.
+     */
+    void dispatchParallel(const ParallelFor& parallel_for);
+
+    /**
+     * @brief Dispatches every priority queue, fanning the thread-safe
+     *        listeners out as jobs.
+     *
+     * @param jobs The job system to run the listeners on.
+     */
+    void dispatchParallel(core::JobSystem& jobs);
+
+    /**
+     * @brief Releases the arena events raised before the previous
+     *        endFrame(). Called by the owner once per frame, after the
+     *        queues have been dispatched.
+     */
+    void endFrame() noexcept;
+
+    /**
+     * @brief Starts or stops capturing raised events into a trace,
+     *        the priority being recorded as the channel. Must be
+     *        set while no other thread raises events.
+     *
+     * @param recorder The recorder to write to, nullptr to stop.
+     */
+    void capture(EventRecorder* recorder) noexcept;
+
+    /**
+     * @brief Clears all queued events from every priority level, and
+     *        releases the events raised through the frame arena.
      */
     void flush();
 
     /**
-     * @brief Clears all event queues and unregisters all listeners.
+     * @brief Clears all event queues, cancels all timers and unregisters all
+     *        listeners.
      */
     void clear();
 
   private:
-    static inline ListenerID next_listener_id = 0;
     static inline constexpr size_t PCOUNT =
         static_cast<size_t>(Priority::COUNT);
 
+  private:
     /**
-     * @struct ListenerEntry
-     * @brief Associates a listener ID with a callback function.
+     * @struct ParallelJob
+     * @brief One thread-safe listener with every event of its type in the
+     *        wave.
      */
-    struct ListenerEntry {
-      ListenerID id;
-      Listener callback;
+    struct ParallelJob {
+      const ListenerTable* table;
+      uint32_t slot;
+      uint32_t first;
+      uint32_t count;
     };
 
-    std::array<std::vector<IEvent*>, PCOUNT> event_buffers;
-    std::unordered_map<IEvent::Type, std::vector<ListenerEntry>> listeners;
+    void deliver(IEvent& event);
+    void stage(size_t priority);
+    bool drained() const noexcept;
+
+  private:
+    // Declared first, so its events outlive the queues pointing at them
+    EventArena arena;
+    std::array<EventQueue, PCOUNT> event_buffers;
+    std::array<EventCoalescer, PCOUNT> coalescers;
+    EventRecorder* recorder;
+
+    // Bit i set when the stage depends on priority i
+    std::array<uint32_t, PCOUNT> dependencies;
+
+    // Scratch storage of dispatchParallel(), kept to reuse its capacity
+    std::vector<IEvent*> staged;
+    std::vector<IEvent*> grouped;
+    std::vector<ParallelJob> parallel_jobs;
+    std::vector<uint32_t> slots;
+
+    TimerWheel timers;
+    Duration timer_remainder;
+
+    // Indexed by event type. A deque keeps the tables in place when a
+    // listener registers a new type while being dispatched
+    std::deque<ListenerTable> listeners;
+
+    // Listeners by category, and the union of the categories they want
+    ListenerTable category_listeners;
+    IEvent::CategoryMask category_interest;
   };
 }  // namespace uranium::event
@@ -0,0 +1,135 @@
+/*******************************************************************
+ * @file   EventArena.hpp
+ * @brief  Frame-scoped bump allocator for raised events.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "uranium/core/Types.hpp"
+
+namespace uranium::event {
+
+  /**
+   * @class EventArena
+   * @brief Constructs events by value in large blocks and releases all of
+   *        them at once, so raising an event never touches the heap.
+   *
+   *        The arena is split in two pages. Events are always created in
+   *        the active page, and recycle() swaps pages after wiping the one
+   *        used before the last recycle. An event therefore stays alive
+   *        until the second recycle() after it was created, which covers
+   *        events raised by other threads while a dispatch is draining.
+   *
+   *        create() is lock-free and may run on any thread, taking a lock
+   *        only when a page runs out of space. A call must not span two
+   *        recycle() calls though, the second one wipes the page it is
+   *        writing to. Threads raising while the owner dispatches must be
+   *        done before the owner recycles twice, e.g. by being joined at
+   *        the end of the frame. recycle() and reset() must only be called
+   *        by the owner thread.
+   */
+  class EventArena final {
+  public:
+    static inline constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+  public:
+    /**
+     * @brief Constructs a new EventArena with one block per page.
+     */
+    explicit EventArena() noexcept;
+
+    /**
+     * @brief Destroys every event left in the arena and frees its blocks.
+     */
+    ~EventArena() noexcept;
+
+    EventArena(const EventArena&) = delete;
+    EventArena& operator=(const EventArena&) = delete;
+
+    /**
+     * @brief Constructs an object of type T inside the active page.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return T* The new object, owned by the arena.
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+      Page& page = pages[active.load(std::memory_order_acquire)];
+
+      void* memory = allocate(page, sizeof(T), alignof(T));
+      T* object = ::new (memory) T(std::forward<Args>(args)...);
+
+      // Only objects that need it pay for a destructor record
+      if constexpr (!std::is_trivially_destructible_v<T>) {
+        void* record = allocate(page, sizeof(Cleanup), alignof(Cleanup));
+        track(page, ::new (record) Cleanup{
+                        [](void* ptr) { static_cast<T*>(ptr)->~T(); },
+                        object, nullptr});
+      }
+      return object;
+    }
+
+    /**
+     * @brief Makes the other page active after wiping it in one step.
+     *        Called once per frame after the events have been dispatched.
+     */
+    void recycle() noexcept;
+
+    /**
+     * @brief Wipes both pages. Only safe when no event is referenced.
+     */
+    void reset() noexcept;
+
+  private:
+    /**
+     * @struct Block
+     * @brief Header placed at the start of every memory block. The usable
+     *        memory follows the header.
+     */
+    struct Block {
+      Block* next;
+      size_t capacity;
+      std::atomic<size_t> offset;
+    };
+
+    /**
+     * @struct Cleanup
+     * @brief Destructor record for an object that is not trivially
+     *        destructible.
+     */
+    struct Cleanup {
+      void (*destroy)(void*);
+      void* object;
+      Cleanup* next;
+    };
+
+    /**
+     * @struct Page
+     * @brief One half of the arena, a chain of blocks bumped in order.
+     */
+    struct Page {
+      std::atomic<Block*> current;
+      std::atomic<Cleanup*> cleanups;
+      std::mutex grow;
+    };
+
+    void* allocate(Page& page, size_t size, size_t align);
+    void track(Page& page, Cleanup* cleanup) noexcept;
+    void wipe(Page& page) noexcept;
+
+    static Block* newBlock(size_t capacity, Block* next);
+
+  private:
+    Page pages[2];
+    std::atomic<uint32_t> active;
+  };
+}  // namespace uranium::event
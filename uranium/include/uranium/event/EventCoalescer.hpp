@@ -0,0 +1,125 @@
+/*******************************************************************
+ * @file   EventCoalescer.hpp
+ * @brief  Merges bursts of high-frequency events into one per dispatch.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <vector>
+
+#include "IEvent.hpp"
+#include "uranium/core/Delegate.hpp"
+#include "uranium/core/Types.hpp"
+
+namespace uranium::event {
+
+  /**
+   * @class EventCoalescer
+   * @brief Holds back events of opted-in types while a queue is drained,
+   *        folding every new occurrence into the held one, and releases a
+   *        single merged event per type afterwards.
+   *
+   *        Without a reducer the newest occurrence replaces the held one.
+   *        With a reducer the first occurrence is kept and every later one
+   *        is merged into it, so that event is modified in place.
+   */
+  class EventCoalescer final {
+  public:
+    /**
+     * @brief Folds `incoming` into `merged`, both of the same event type.
+     */
+    using Reducer = core::Delegate<void(IEvent& merged, IEvent& incoming)>;
+
+  public:
+    /**
+     * @brief Constructs an EventCoalescer with no coalesced types.
+     */
+    explicit EventCoalescer() noexcept;
+
+    /**
+     * @brief Enables coalescing for an event type.
+     *
+     * @param type    The event type to coalesce.
+     * @param reducer How to merge two occurrences. When empty, the last
+     *                occurrence wins.
+     */
+    void enable(IEvent::Type type, Reducer reducer = nullptr);
+
+    /**
+     * @brief Disables coalescing for an event type. Must not be called
+     *        while events of that type are held.
+     *
+     * @param type The event type to stop coalescing.
+     */
+    void disable(IEvent::Type type);
+
+    /**
+     * @brief Holds the event back if its type is coalesced.
+     *
+     * @param event The event popped from a queue.
+     * @return true if the event was absorbed and must not be delivered now.
+     * @return false if the event is not coalesced.
+     */
+    bool absorb(IEvent* event);
+
+    /**
+     * @brief Releases the merged events, in the order their types were
+     *        first absorbed.
+     *
+     * @return IEvent* The next merged event, or nullptr when none is left.
+     */
+    IEvent* release() noexcept;
+
+    /**
+     * @brief Drops every held event without releasing it.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Builds a reducer adding the given data members of the
+     *        incoming event into the merged one, e.g. to sum deltas.
+     *
+     * @tparam Members Pointers to data members of the same event class.
+     */
+    template <auto... Members>
+    static Reducer sum() {
+      return [](IEvent& merged, IEvent& incoming) {
+        ((static_cast<OwnerOf<decltype(Members)>&>(merged).*Members +=
+          static_cast<OwnerOf<decltype(Members)>&>(incoming).*Members),
+         ...);
+      };
+    }
+
+  private:
+    template <typename T>
+    struct MemberTraits;
+
+    template <typename Class, typename Value>
+    struct MemberTraits<Value Class::*> {
+      using Owner = Class;
+    };
+
+    template <typename T>
+    using OwnerOf = typename MemberTraits<T>::Owner;
+
+    /**
+     * @struct Rule
+     * @brief Coalescing setup of one event type, and the event held for it.
+     */
+    struct Rule {
+      bool enabled = false;
+      Reducer reducer;
+      IEvent* held = nullptr;
+    };
+
+  private:
+    // Indexed by event type
+    std::vector<Rule> rules;
+
+    // Types holding an event, in the order they were first absorbed
+    std::vector<IEvent::Type> held_types;
+    size_t released;
+  };
+}  // namespace uranium::event
@@ -7,12 +7,16 @@
  *******************************************************************/
 #pragma once
 
-#include <functional>
-#include <queue>
-#include <unordered_map>
-#include <vector>
+#include <deque>
+#include <type_traits>
+#include <utility>
 
+#include "EventArena.hpp"
+#include "EventCoalescer.hpp"
+#include "EventQueue.hpp"
+#include "EventTrace.hpp"
 #include "IEvent.hpp"
+#include "ListenerTable.hpp"
 #include "uranium/core/Types.hpp"
 
 namespace uranium::event {
@@ -24,11 +28,14 @@ namespace uranium::event {
    *
    *        Events are organized by priority and can be dispatched
    *        selectively or flushed entirely.
+   *
+   *        raise() may be called from any thread. Every other method must
+   *        be called from the thread that owns the dispatcher.
    */
   class EventDispatcher final {
   public:
-    using ListenerID = uint64_t;
-    using Listener = std::function<void(IEvent&)>;
+    using ListenerID = ListenerTable::Handle;
+    using Listener = ListenerTable::Listener;
 
   public:
     /**
@@ -48,24 +55,105 @@ namespace uranium::event {
      * @param type     The event type to listen for.
      * @param priority Priority of the listener corresponding to the event.
      * @param listener The callback function to invoke on dispatch.
+     * @return ListenerID A unique ID used for listener removal.
+     */
+    ListenerID subscribe(IEvent::Type type, uint32_t priority,
+                         Listener listener);
+
+    /**
+     * @brief Unregisters a previously subscribed listener in constant time.
+     *
+     * @param type The event type associated with the listener.
+     * @param id   The unique ID of the listener.
+     * @return true if the listener was removed successfully.
+     * @return false if the listener was not found.
+     */
+    bool unsubscribe(IEvent::Type type, ListenerID id);
+
+    /**
+     * @brief Registers a listener for every event sharing a category with
+     *        the mask, e.g. IEvent::INPUT | IEvent::WINDOW. Category
+     *        listeners are invoked after the listeners of the event type.
+     *
+     * @param categories The categories to listen for.
+     * @param priority   Priority among the other category listeners.
+     * @param listener   The callback function to invoke on dispatch.
+     * @return ListenerID A unique ID used for listener removal.
      */
-    void subscribe(IEvent::Type type, uint32_t priority, Listener listener);
+    ListenerID subscribeCategory(IEvent::CategoryMask categories,
+                                 uint32_t priority, Listener listener);
 
     /**
-     * @brief Queues a new event under a specified priority.
+     * @brief Unregisters a previously subscribed category listener.
+     *
+     * @param id The unique ID of the listener.
+     * @return true if the listener was removed successfully.
+     * @return false if the listener was not found.
+     */
+    bool unsubscribeCategory(ListenerID id);
+
+    /**
+     * @brief Queues a new event. Lock-free and safe to call from any thread.
+     *        The caller keeps ownership of the event and must keep it alive
+     *        until it has been dispatched or flushed. The event is dropped
+     *        if the queue is full, see EventQueue.
      *
      * @param event A pointer to the event object.
      */
     void raise(IEvent* event);
 
     /**
-     * @brief Dispatches and processes all events in a given priority queue.
+     * @brief Constructs an event in the frame arena and queues it. The event
+     *        is owned by the dispatcher and destroyed by the second
+     *        dispatch() or flush() after it was raised. Safe to call from
+     *        any thread that is done raising by then, see EventArena.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     */
+    template <typename T, typename... Args>
+    void raise(Args&&... args) {
+      static_assert(std::is_base_of_v<IEvent, T>,
+                    "Raised events must derive from IEvent.");
+      raise(arena.create<T>(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Coalesces the events of a type queued between two dispatches,
+     *        so listeners see a single merged event per dispatch. Merged
+     *        events are delivered after the other queued events.
+     *
+     * @param type    The event type to coalesce, e.g. CURSOR_MOVED.
+     * @param reducer How to merge two occurrences, for example
+     *                EventCoalescer::sum<&Event::dx, &Event::dy>(). When
+     *                empty, the last occurrence wins.
+     */
+    void coalesce(IEvent::Type type, EventCoalescer::Reducer reducer = nullptr);
+
+    /**
+     * @brief Delivers every event of a type again, undoing coalesce().
+     *
+     * @param type The event type to stop coalescing.
+     */
+    void stopCoalescing(IEvent::Type type);
+
+    /**
+     * @brief Starts or stops capturing raised events into a trace. Must be
+     *        set while no other thread raises events.
+     *
+     * @param recorder The recorder to write to, nullptr to stop.
+     */
+    void capture(EventRecorder* recorder) noexcept;
+
+    /**
+     * @brief Dispatches and processes all events in the queue, in the order
+     *        they were raised. Drains the queue without taking a lock.
      *
      */
     void dispatch();
 
     /**
-     * @brief Clears all queued events from every priority level.
+     * @brief Clears all queued events from every priority level, and
+     *        releases the events raised through the frame arena.
      */
     void flush();
 
@@ -75,31 +163,21 @@ namespace uranium::event {
     void clear();
 
   private:
-    static inline ListenerID next_listener_id = 0;
+    void deliver(IEvent& event);
 
-    /**
-     * @struct ListenerEntry
-     * @brief Associates a listener ID with a callback function.
-     */
-    struct ListenerEntry {
-      ListenerID id;
-      uint32_t priority;
-      Listener callback;
-    };
-
-    struct Queue {
-      uint32_t head;
-      uint32_t tail;
-      std::array<IEvent*, 512> buffer;
-    };
-
-    // TODO: Make the event queue have a max limit
-    // Add another queue that keeps track of the overflowed events.
-    // Handle the in-bound events using a cyclical queue.
-    // It can handle by default from [0, 512] events in one buffer.
-    // Mixing different kind of event types into one dispatcher can be
-    // performance costly, so better optimize it or just leave it like that.
-    std::vector<IEvent*> event_queue;
-    std::unordered_map<IEvent::Type, std::vector<ListenerEntry>> listeners;
+  private:
+    // Declared first, so its events outlive the queue pointing at them
+    EventArena arena;
+    EventQueue event_queue;
+    EventCoalescer coalescer;
+    EventRecorder* recorder;
+
+    // Indexed by event type. A deque keeps the tables in place when a
+    // listener subscribes to a new type while being dispatched
+    std::deque<ListenerTable> listeners;
+
+    // Listeners by category, and the union of the categories they want
+    ListenerTable category_listeners;
+    IEvent::CategoryMask category_interest;
   };
 }  // namespace uranium::event
@@ -0,0 +1,106 @@
+/*******************************************************************
+ * @file   EventQueue.hpp
+ * @brief  Lock-free event queue fed by many threads, drained by one.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <atomic>
+
+#include "IEvent.hpp"
+#include "uranium/core/MPSCRing.hpp"
+#include "uranium/core/Types.hpp"
+
+namespace uranium::event {
+
+  /**
+   * @class EventQueue
+   * @brief Bounded cyclic queue of events with a spill ring.
+   *
+   *        Events are pushed into a fixed ring of CAPACITY slots. When the
+   *        ring is full, the event is spilled into a second ring of
+   *        SPILL_CAPACITY slots instead of being dropped. Once a spill
+   *        happened, producers keep spilling until the consumer has drained
+   *        the spill ring, so events raised by the same thread are always
+   *        popped in order. Both rings are owned by the queue, so a burst
+   *        past the first one neither touches the heap nor depends on the
+   *        lifetime of any arena. Only when both rings are full is an event
+   *        dropped, and counted.
+   *
+   *        push() is safe from any thread. pop() and clear() must only be
+   *        called by the thread that owns the queue.
+   */
+  class EventQueue final {
+  public:
+    static inline constexpr size_t CAPACITY = 512;
+    static inline constexpr size_t SPILL_CAPACITY = 4096;
+
+  public:
+    /**
+     * @brief Constructs an empty EventQueue.
+     */
+    explicit EventQueue() noexcept;
+
+    /**
+     * @brief Destroys the EventQueue, dropping any queued event.
+     */
+    ~EventQueue() noexcept;
+
+    EventQueue(const EventQueue&) = delete;
+    EventQueue& operator=(const EventQueue&) = delete;
+
+    /**
+     * @brief Queues an event. Safe to call from any thread.
+     *
+     * @param event A pointer to the event object.
+     * @return true if the event was queued.
+     * @return false if both rings are full and the event was dropped.
+     */
+    bool push(IEvent* event) noexcept;
+
+    /**
+     * @brief Pops the oldest event available to the consumer.
+     *
+     * @return IEvent* The event, or nullptr if nothing is ready.
+     */
+    IEvent* pop() noexcept;
+
+    /**
+     * @brief Discards every queued event.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Checks if no event is queued, including events a producer is
+     *        still writing.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Number of events that did not fit in the ring and were
+     *        spilled into the spill ring since construction.
+     */
+    uint64_t overflowCount() const noexcept;
+
+    /**
+     * @brief Number of events dropped because both rings were full since
+     *        construction.
+     */
+    uint64_t droppedCount() const noexcept;
+
+  private:
+    core::MPSCRing<IEvent*, CAPACITY> ring;
+
+    // Events pushed while the ring was full or while older spilled events
+    // were still waiting, popped once the ring is empty
+    core::MPSCRing<IEvent*, SPILL_CAPACITY> spill;
+
+    // Events in the spill ring, counted before they are pushed so that a
+    // producer reading zero knows its own spilled events were popped
+    std::atomic<size_t> spilled;
+    std::atomic<uint64_t> overflowed;
+    std::atomic<uint64_t> dropped;
+  };
+}  // namespace uranium::event
@@ -0,0 +1,224 @@
+/*******************************************************************
+ * @file   EventTrace.hpp
+ * @brief  Binary capture of raised events and frame-accurate replay.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "IEvent.hpp"
+#include "uranium/core/Types.hpp"
+
+namespace uranium::event {
+
+  class EventDispatcher;
+  class DynamicEventManager;
+
+  /**
+   * @brief Layout of a trace file. Every field is stored in the byte order
+   *        of the machine that captured it.
+   *
+   *        header  : MAGIC u32, VERSION u16, reserved u16
+   *        frame   : FRAME u8, time since capture start in us u64
+   *        event   : EVENT u8, channel u8, payload size u16,
+   *                  time since frame start in us u32, payload
+   */
+  namespace trace {
+    static inline constexpr uint32_t MAGIC = 0x52545255;  // "URTR"
+    static inline constexpr uint16_t VERSION = 2;
+
+    static inline constexpr uint8_t FRAME = 0;
+    static inline constexpr uint8_t EVENT = 1;
+  }  // namespace trace
+
+  /**
+   * @class EventRecorder
+   * @brief Writes every raised event of the registered types, with its
+   *        channel, timestamp and payload, to a binary trace file.
+   *
+   *        Only register the types that come from outside the simulation,
+   *        such as input or network events. Events raised by listeners are
+   *        raised again when the trace is replayed, and must stay out of
+   *        it. Payloads are copied bytewise, so traced events must be
+   *        trivially copyable.
+   *
+   *        record() is safe from any thread, like raise().
+   */
+  class EventRecorder final {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+  public:
+    /**
+     * @brief Constructs a recorder with no file open.
+     */
+    explicit EventRecorder() noexcept;
+
+    /**
+     * @brief Flushes and closes the trace file.
+     */
+    ~EventRecorder() noexcept;
+
+    EventRecorder(const EventRecorder&) = delete;
+    EventRecorder& operator=(const EventRecorder&) = delete;
+
+    /**
+     * @brief Starts a new trace, truncating the file.
+     *
+     * @param path Path of the trace file.
+     * @return true if the file could be opened.
+     */
+    bool open(std::string_view path);
+
+    /**
+     * @brief Ends the current frame and closes the trace file.
+     */
+    void close();
+
+    /**
+     * @brief Registers an event type to be captured.
+     *
+     * @param type The type identifier events of T are raised with.
+     */
+    template <typename T>
+    void traceable(IEvent::Type type) {
+      static_assert(std::is_base_of_v<IEvent, T>,
+                    "Traced events must derive from IEvent.");
+      static_assert(std::is_trivially_copyable_v<T>,
+                    "Traced events are copied bytewise.");
+      static_assert(sizeof(T) <= UINT16_MAX, "Event payload is too large.");
+      traceable(type, sizeof(T));
+    }
+
+    /**
+     * @brief Writes an event to the trace if its type was registered.
+     *
+     * @param channel Queue the event was raised in, e.g. its priority.
+     * @param event   The raised event.
+     */
+    void record(uint32_t channel, const IEvent& event);
+
+    /**
+     * @brief Marks a frame boundary. Events recorded from now on are
+     *        replayed in the next frame.
+     */
+    void frame();
+
+    /**
+     * @brief Checks if a trace file is open.
+     */
+    bool recording() const noexcept;
+
+  private:
+    void traceable(IEvent::Type type, size_t size);
+
+    template <typename T>
+    void write(const T& value) {
+      file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+  private:
+    std::mutex mutex;
+    std::ofstream file;
+
+    // Payload size of every traceable type, 0 for the others
+    std::vector<uint16_t> sizes;
+
+    Clock::time_point start;
+    Clock::time_point frame_start;
+  };
+
+  /**
+   * @class EventReplayer
+   * @brief Reads a trace file back and raises its events, one recorded
+   *        frame at a time.
+   *
+   *        Replayed events are owned by the replayer and stay alive until
+   *        the next call to next().
+   */
+  class EventReplayer final {
+  public:
+    using Duration = std::chrono::microseconds;
+
+  public:
+    /**
+     * @brief Constructs a replayer with no trace loaded.
+     */
+    explicit EventReplayer() noexcept;
+
+    /**
+     * @brief Loads a whole trace file in memory.
+     *
+     * @param path Path of the trace file.
+     * @return true if the file is a valid trace.
+     */
+    bool load(std::string_view path);
+
+    /**
+     * @brief Raises the events of the next recorded frame.
+     *
+     * @param dispatcher Where to raise the events, channels are ignored.
+     * @return false once the trace has been fully replayed.
+     */
+    bool next(EventDispatcher& dispatcher);
+
+    /**
+     * @brief Raises the events of the next recorded frame, each in the
+     *        priority it was recorded with.
+     *
+     * @param manager Where to raise the events.
+     * @return false once the trace has been fully replayed.
+     */
+    bool next(DynamicEventManager& manager);
+
+    /**
+     * @brief Duration of the frame last replayed, as it was recorded. Feed
+     *        it to the timers to replay their timing as well.
+     */
+    Duration elapsed() const noexcept;
+
+    /**
+     * @brief Index of the frame last replayed.
+     */
+    size_t frame() const noexcept;
+
+    /**
+     * @brief Restarts the replay from the first frame.
+     */
+    void rewind() noexcept;
+
+  private:
+    /**
+     * @struct Replayed
+     * @brief One event of the current frame.
+     */
+    struct Replayed {
+      IEvent* event;
+      size_t offset;  // Position of the event in the storage
+      uint32_t channel;
+    };
+
+    bool decodeFrame();
+
+  private:
+    std::vector<std::byte> data;
+    size_t cursor;
+
+    // Storage of the events of the current frame, kept suitably aligned
+    std::vector<std::max_align_t> storage;
+    std::vector<Replayed> events;
+
+    size_t frames;
+    uint64_t last_time;
+    Duration frame_elapsed;
+  };
+}  // namespace uranium::event
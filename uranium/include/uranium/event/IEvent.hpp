@@ -8,6 +8,7 @@
 #pragma once
 
 #include "uranium/core/Types.hpp"
+#include "uranium/core/Utils.hpp"
 
 namespace uranium::event {
 
@@ -20,18 +21,48 @@ namespace uranium::event {
    */
   UR_ABSTRACT_CLASS IEvent {
   public:
-    using Type = uint32_t;  // Event type identifier
+    using Type = uint32_t;          // Event type identifier
+    using CategoryMask = uint32_t;  // Combination of Category bits
+
+    /**
+     * @enum Category
+     * @brief Broad families of events, combined into a mask so a listener
+     *        can receive a whole family with a single subscription.
+     */
+    enum Category : CategoryMask {
+      NONE = 0,
+      APPLICATION = UR_BIT(0),
+      INPUT = UR_BIT(1),  // Every mouse, cursor and keyboard event
+      MOUSE = UR_BIT(2),
+      CURSOR = UR_BIT(3),
+      KEYBOARD = UR_BIT(4),
+      WINDOW = UR_BIT(5),
+      NETWORK = UR_BIT(6),
+      GAME = UR_BIT(7),
+      ALL = UINT32_MAX,
+    };
 
   public:
     /**
-     * @brief Constructs a new event with the given type ID.
+     * @brief Constructs a new event with the given type ID. Built-in types
+     *        get their categories assigned, other types get none.
      *
      * @param type A unique identifier for the event type.
      */
-    IEvent(IEvent::Type type) : type(type) {}
+    IEvent(IEvent::Type type) : type(type), categories(categoriesOf(type)) {}
+
+    /**
+     * @brief Constructs a new event with the given type ID and categories.
+     *
+     * @param type       A unique identifier for the event type.
+     * @param categories The categories the event belongs to.
+     */
+    IEvent(IEvent::Type type, CategoryMask categories)
+        : type(type), categories(categories) {}
 
   public:
     IEvent::Type type;
+    CategoryMask categories;
 
   public:
     /**
@@ -96,6 +127,37 @@ namespace uranium::event {
       COUNT,
     };
 
+    /**
+     * @brief Categories of a built-in event type.
+     *
+     * @param type The event type.
+     * @return The categories of the type, NONE for client-defined types.
+     */
+    static constexpr CategoryMask categoriesOf(Type type) noexcept {
+      if (type <= static_cast<Type>(Builtin::APPLICATION_RESUME)) {
+        return APPLICATION;
+      }
+      if (type <= static_cast<Type>(Builtin::MOUSE_WHEEL)) {
+        return INPUT | MOUSE;
+      }
+      if (type <= static_cast<Type>(Builtin::CURSOR_DROPPED)) {
+        return INPUT | CURSOR;
+      }
+      if (type <= static_cast<Type>(Builtin::KEY_TYPED)) {
+        return INPUT | KEYBOARD;
+      }
+      if (type <= static_cast<Type>(Builtin::WINDOW_FOCUS_LOST)) {
+        return WINDOW;
+      }
+      if (type <= static_cast<Type>(Builtin::NETWORK_DATA_SENT)) {
+        return NETWORK;
+      }
+      if (type == static_cast<Type>(Builtin::GAME_EVENT)) {
+        return GAME;
+      }
+      return NONE;
+    }
+
   private:
     friend class EventManager;
 
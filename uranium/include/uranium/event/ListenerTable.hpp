@@ -0,0 +1,176 @@
+/*******************************************************************
+ * @file   ListenerTable.hpp
+ * @brief  Dense, priority ordered storage for the listeners of an event.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "IEvent.hpp"
+#include "uranium/core/Delegate.hpp"
+#include "uranium/core/Types.hpp"
+
+namespace uranium::event {
+
+  /**
+   * @class ListenerTable
+   * @brief Holds the listeners of one event type in slots reused through a
+   *        free list, and an index of those slots kept in priority order.
+   *
+   *        Adding a listener inserts its slot with a binary search instead
+   *        of re-sorting, and removing one is O(1): the slot is only marked
+   *        dead and the order is compacted once dead slots pile up.
+   *        Listeners may add or remove listeners while being invoked; new
+   *        listeners start receiving events after the current one.
+   */
+  class ListenerTable final {
+  public:
+    using Handle = uint64_t;
+    using Listener = core::Delegate<void(IEvent&)>;
+
+    /**
+     * @enum Concurrency
+     * @brief Declares where a listener may be invoked from.
+     */
+    enum class Concurrency {
+      MAIN_THREAD = 0,  // Only on the thread that dispatches
+      THREAD_SAFE,      // On any thread, concurrently with other listeners
+    };
+
+    static inline constexpr Handle INVALID_HANDLE = 0;
+
+  public:
+    /**
+     * @brief Constructs an empty ListenerTable.
+     */
+    explicit ListenerTable() noexcept;
+
+    /**
+     * @brief Adds a listener. Higher priorities are invoked first, equal
+     *        priorities in the order they were added.
+     *
+     * @param priority    Priority of the listener.
+     * @param listener    The callback to invoke.
+     * @param concurrency Where the listener may be invoked from.
+     * @param categories  Categories of the events the listener wants, only
+     *                    looked at by invokeMatching().
+     * @return Handle A handle used for listener removal.
+     */
+    Handle add(uint32_t priority, Listener listener,
+               Concurrency concurrency = Concurrency::MAIN_THREAD,
+               IEvent::CategoryMask categories = IEvent::ALL);
+
+    /**
+     * @brief Removes a listener in constant time.
+     *
+     * @param handle The handle returned by add().
+     * @return true if the listener was removed successfully.
+     * @return false if the handle is stale or unknown.
+     */
+    bool remove(Handle handle);
+
+    /**
+     * @brief Invokes every live listener in priority order.
+     *
+     * @param event The event to hand to the listeners.
+     */
+    void invoke(IEvent& event);
+
+    /**
+     * @brief Invokes the live listeners declared with the given
+     *        concurrency, in priority order.
+     *
+     * @param event The event to hand to the listeners.
+     * @param only  The concurrency of the listeners to invoke.
+     */
+    void invoke(IEvent& event, Concurrency only);
+
+    /**
+     * @brief Invokes the live listeners sharing a category with the event,
+     *        in priority order.
+     *
+     * @param event The event to hand to the listeners.
+     */
+    void invokeMatching(IEvent& event);
+
+    /**
+     * @brief Collects the slots of the live thread-safe listeners, so they
+     *        can be invoked one by one from worker threads.
+     *
+     * @param out Receives the slot indices, in priority order.
+     */
+    void collectThreadSafe(std::vector<uint32_t>& out) const;
+
+    /**
+     * @brief Invokes a single listener slot. Safe to call concurrently as
+     *        long as no listener is added or removed meanwhile.
+     *
+     * @param slot  A slot index given by collectThreadSafe().
+     * @param event The event to hand to the listener.
+     */
+    void invokeSlot(uint32_t slot, IEvent& event) const;
+
+    /**
+     * @brief Removes every listener.
+     */
+    void clear();
+
+    /**
+     * @brief Checks if the table has no live listeners.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Number of live listeners.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Number of live thread-safe listeners.
+     */
+    size_t threadSafeCount() const noexcept;
+
+    /**
+     * @brief Union of the categories of the live listeners. Walks the
+     *        whole table, callers are expected to cache it.
+     */
+    IEvent::CategoryMask categories() const noexcept;
+
+  private:
+    /**
+     * @struct Slot
+     * @brief Storage of one listener. The generation is bumped on removal
+     *        so stale handles can be told apart.
+     */
+    struct Slot {
+      Listener callback;
+      uint32_t generation;
+      uint32_t priority;
+      Concurrency concurrency;
+      IEvent::CategoryMask categories;
+      bool alive;
+    };
+
+    void settle();
+    void insert(uint32_t index);
+    void compact();
+
+  private:
+    // A deque keeps slots in place while a listener adds another one
+    std::deque<Slot> slots;
+    std::vector<uint32_t> free_slots;
+
+    // Slot indices by descending priority, may still hold dead slots
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> pending;
+
+    size_t alive_count;
+    size_t thread_safe_count;
+    size_t dead_count;
+    uint32_t dispatch_depth;
+  };
+}  // namespace uranium::event
@@ -0,0 +1,274 @@
+/*******************************************************************
+ * @file   StaticEventBus.hpp
+ * @brief  Event bus whose event set is fixed at compile time.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "uranium/core/Types.hpp"
+
+namespace uranium::event {
+
+  /**
+   * @class StaticEventBus
+   * @brief Dispatches a closed set of event types known at compile time.
+   *
+   *        Each event type owns a fixed array of listeners and a queue of
+   *        events stored by value, both found through the type itself, so
+   *        there is no hash lookup and no type erasure. Listeners receive
+   *        the concrete event type, and every listener is called through a
+   *        thunk generated for it, where the compiler can inline the call.
+   *
+   *        Events do not need to derive from IEvent.
+   *
+   * @tparam Events The event types the bus handles, each listed once.
+   */
+  template <typename... Events>
+  class StaticEventBus final {
+    template <typename E>
+    static constexpr size_t countOf() {
+      return (size_t{0} + ... + (std::is_same_v<E, Events> ? 1 : 0));
+    }
+
+    static_assert(sizeof...(Events) > 0,
+                  "StaticEventBus needs at least one event type.");
+    static_assert(((countOf<Events>() == 1) && ...),
+                  "StaticEventBus event types must be unique.");
+
+  public:
+    using ListenerID = uint32_t;
+
+    static inline constexpr size_t MAX_LISTENERS = 32;
+    static inline constexpr ListenerID INVALID_LISTENER = 0;
+
+  public:
+    explicit StaticEventBus() noexcept = default;
+
+    StaticEventBus(const StaticEventBus&) = delete;
+    StaticEventBus& operator=(const StaticEventBus&) = delete;
+
+    /**
+     * @brief Checks if an event type is part of this bus.
+     */
+    template <typename E>
+    static constexpr bool handles() {
+      return countOf<E>() == 1;
+    }
+
+    /**
+     * @brief Registers a member function as listener of event E.
+     *
+     * @tparam E      The event type to listen for.
+     * @tparam Method Member function taking E& or const E&.
+     * @param instance The object the method is called on. Must outlive
+     *                 the subscription.
+     * @return ListenerID A unique ID used for listener removal, or
+     *         INVALID_LISTENER if the listener table of E is full.
+     */
+    template <typename E, auto Method, typename Class>
+    ListenerID subscribe(Class& instance) {
+      return table<E>().add(&instance, [](void* object, E& event) {
+        (static_cast<Class*>(object)->*Method)(event);
+      });
+    }
+
+    /**
+     * @brief Registers a free function as listener of event E.
+     *
+     * @tparam E        The event type to listen for.
+     * @tparam Function Function taking E& or const E&.
+     * @return ListenerID A unique ID used for listener removal, or
+     *         INVALID_LISTENER if the listener table of E is full.
+     */
+    template <typename E, auto Function>
+    ListenerID subscribe() {
+      return table<E>().add(nullptr,
+                            [](void*, E& event) { Function(event); });
+    }
+
+    /**
+     * @brief Unregisters a listener of event E.
+     *
+     * @param id The unique ID of the listener.
+     * @return true if the listener was removed successfully.
+     * @return false if the listener was not found.
+     */
+    template <typename E>
+    bool unsubscribe(ListenerID id) {
+      return table<E>().remove(id);
+    }
+
+    /**
+     * @brief Delivers an event to its listeners immediately.
+     *
+     * @param event The event to deliver.
+     */
+    template <typename E>
+    void publish(E& event) {
+      table<E>().invoke(event);
+    }
+
+    /**
+     * @brief Constructs an event in the queue of its type, to be delivered
+     *        on the next dispatch().
+     *
+     * @param args Arguments forwarded to the constructor of E.
+     */
+    template <typename E, typename... Args>
+    void raise(Args&&... args) {
+      table<E>().queue.emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Delivers every queued event, one type after the other in the
+     *        order the types were declared. Events raised by listeners
+     *        during the dispatch are delivered before it returns. When a
+     *        listener dispatches again, the type being delivered is left to
+     *        the outer dispatch.
+     */
+    void dispatch() {
+      bool pending = true;
+      while (pending) {
+        pending = false;
+        std::apply([&](auto&... tables) { (tables.drain(pending), ...); },
+                   this->tables);
+      }
+    }
+
+    /**
+     * @brief Clears all queued events.
+     */
+    void flush() {
+      std::apply([](auto&... tables) { (tables.queue.clear(), ...); },
+                 this->tables);
+    }
+
+    /**
+     * @brief Clears all queued events and unregisters all listeners.
+     */
+    void clear() {
+      flush();
+      std::apply(
+          [](auto&... tables) {
+            ((tables.count = 0, tables.dead_count = 0), ...);
+          },
+          this->tables);
+    }
+
+  private:
+    /**
+     * @struct Table
+     * @brief Listeners and queued events of a single event type.
+     */
+    template <typename E>
+    struct Table {
+      using Thunk = void (*)(void*, E&);
+
+      struct Slot {
+        ListenerID id;
+        void* object;
+        Thunk thunk;
+      };
+
+      std::array<Slot, MAX_LISTENERS> slots{};
+      size_t count = 0;
+      ListenerID next_id = INVALID_LISTENER + 1;
+
+      // Listeners removed while invoking are only marked dead, and the
+      // slots compacted once the outermost invoke() returns
+      size_t dead_count = 0;
+      uint32_t invoke_depth = 0;
+
+      std::vector<E> queue;
+      std::vector<E> draining;
+      bool in_drain = false;
+
+      ListenerID add(void* object, Thunk thunk) {
+        if (count == MAX_LISTENERS) {
+          return INVALID_LISTENER;
+        }
+        slots[count++] = Slot{next_id, object, thunk};
+        return next_id++;
+      }
+
+      bool remove(ListenerID id) {
+        for (size_t i = 0; i < count; ++i) {
+          if (slots[i].id != id || !slots[i].thunk) {
+            continue;
+          }
+          // Shifting now would make a running invoke() skip a listener
+          if (invoke_depth > 0) {
+            slots[i].thunk = nullptr;
+            ++dead_count;
+            return true;
+          }
+          // Shift the tail down to keep the subscription order
+          for (size_t j = i + 1; j < count; ++j) {
+            slots[j - 1] = slots[j];
+          }
+          --count;
+          return true;
+        }
+        return false;
+      }
+
+      void invoke(E& event) {
+        ++invoke_depth;
+        for (size_t i = 0; i < count; ++i) {
+          if (slots[i].thunk) {
+            slots[i].thunk(slots[i].object, event);
+          }
+        }
+        if (--invoke_depth == 0 && dead_count > 0) {
+          compact();
+        }
+      }
+
+      void compact() {
+        size_t alive = 0;
+        for (size_t i = 0; i < count; ++i) {
+          if (slots[i].thunk) {
+            slots[alive++] = slots[i];
+          }
+        }
+        count = alive;
+        dead_count = 0;
+      }
+
+      void drain(bool& pending) {
+        // A nested dispatch() must not swap the vector being iterated, the
+        // outer one delivers whatever is queued after it
+        if (queue.empty() || in_drain) {
+          return;
+        }
+        // Listeners may raise more events of this type, swap the queue
+        // out so they land in the next pass instead of invalidating this
+        in_drain = true;
+        draining.swap(queue);
+        for (E& event : draining) {
+          invoke(event);
+        }
+        draining.clear();
+        in_drain = false;
+        pending = true;
+      }
+    };
+
+    template <typename E>
+    Table<E>& table() {
+      static_assert(handles<E>(), "Event type is not part of this bus.");
+      return std::get<Table<E>>(tables);
+    }
+
+  private:
+    std::tuple<Table<Events>...> tables;
+  };
+}  // namespace uranium::event
@@ -0,0 +1,138 @@
+/*******************************************************************
+ * @file   TimerWheel.hpp
+ * @brief  Hierarchical timing wheel for delayed and periodic events.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "IEvent.hpp"
+#include "uranium/core/Delegate.hpp"
+#include "uranium/core/Types.hpp"
+
+namespace uranium::event {
+
+  /**
+   * @class TimerWheel
+   * @brief Schedules events to fire after a number of ticks, once or
+   *        periodically.
+   *
+   *        Timers are kept in LEVELS wheels of SLOTS buckets each, level N
+   *        covering SLOTS^(N+1) ticks. Scheduling and cancelling only link
+   *        or unlink a timer in one bucket. Advancing a tick visits a single
+   *        bucket of the first wheel, and the buckets of the outer wheels
+   *        are redistributed once per revolution of the wheel below, so a
+   *        pending timer costs nothing until it is about to fire.
+   */
+  class TimerWheel final {
+  public:
+    using Tick = uint64_t;
+    using TimerID = uint64_t;
+
+    /**
+     * @brief Receives the event and channel of every timer that fires.
+     */
+    using Callback = core::Delegate<void(IEvent& event, uint32_t channel)>;
+
+    static inline constexpr TimerID INVALID_TIMER = 0;
+    static inline constexpr uint32_t LEVELS = 4;
+    static inline constexpr uint32_t SLOT_BITS = 8;
+    static inline constexpr uint32_t SLOTS = 1u << SLOT_BITS;
+
+  public:
+    /**
+     * @brief Constructs an empty TimerWheel starting at tick zero.
+     */
+    explicit TimerWheel() noexcept;
+
+    /**
+     * @brief Schedules a timer.
+     *
+     * @param delay   Ticks until the first firing, at least one.
+     * @param period  Ticks between firings, or zero to fire only once.
+     * @param event   The event handed to the callback. Must outlive the
+     *                timer.
+     * @param channel Opaque value handed to the callback with the event.
+     * @return TimerID A handle used to cancel the timer.
+     */
+    TimerID schedule(Tick delay, Tick period, IEvent* event, uint32_t channel);
+
+    /**
+     * @brief Cancels a pending timer.
+     *
+     * @param id The handle returned by schedule().
+     * @return true if the timer was cancelled.
+     * @return false if it already fired or the handle is unknown.
+     */
+    bool cancel(TimerID id);
+
+    /**
+     * @brief Moves time forward, firing every timer that expires.
+     *
+     * @param ticks    Number of ticks to advance.
+     * @param callback Invoked for each timer that fires, in expiry order.
+     */
+    void advance(Tick ticks, const Callback& callback);
+
+    /**
+     * @brief Cancels every timer.
+     */
+    void clear();
+
+    /**
+     * @brief Number of pending timers.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Current tick of the wheel.
+     */
+    Tick now() const noexcept;
+
+  private:
+    static inline constexpr uint32_t NIL = UINT32_MAX;
+    static inline constexpr uint8_t UNLINKED = UINT8_MAX;
+    static inline constexpr Tick SLOT_MASK = SLOTS - 1;
+
+    /**
+     * @struct Timer
+     * @brief A pending timer, linked into the bucket it expires in.
+     */
+    struct Timer {
+      Tick expires;
+      Tick period;
+      IEvent* event;
+      uint32_t channel;
+      uint32_t generation;
+      uint32_t prev;
+      uint32_t next;
+      uint8_t level;
+      uint8_t slot;
+      bool active;
+    };
+
+    void link(uint32_t index);
+    void unlink(uint32_t index);
+    void release(uint32_t index);
+    void cascade(uint32_t level);
+    void step(const Callback& callback);
+
+  private:
+    std::vector<Timer> timers;
+    std::vector<uint32_t> free_timers;
+
+    // Index and generation of the timers expiring in the current step
+    std::vector<std::pair<uint32_t, uint32_t>> firing;
+
+    std::array<std::array<uint32_t, SLOTS>, LEVELS> buckets;
+    std::array<size_t, LEVELS> level_counts;
+
+    Tick current;
+    size_t pending;
+  };
+}  // namespace uranium::event
@@ -0,0 +1,69 @@
+/*******************************************************************
+ * @file   Batch.hpp
+ * @brief  Kernels transforming whole arrays of points and matrices.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Matrix.hpp"
+
+namespace uranium::math {
+
+  /**
+   * @struct PointsSoA
+   * @brief Points stored as one array per coordinate, so a register holds
+   *        the same coordinate of 4 (SSE) or 8 (AVX) points and a matrix
+   *        applies to all of them with broadcast multiply-adds.
+   */
+  struct PointsSoA {
+    float* x = nullptr;
+    float* y = nullptr;
+    float* z = nullptr;
+  };
+
+  // Parent of the roots of a hierarchy
+  static inline constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+  /**
+   * @brief Transforms points with w = 1, without the perspective divide.
+   *        The output may be the input, but must not partially overlap it.
+   *
+   * @param m      Affine transform.
+   * @param in     Points to transform.
+   * @param out    Transformed points.
+   * @param count  Number of points.
+   */
+  void transformPoints(const mat4& m, const PointsSoA& in,
+                       const PointsSoA& out, size_t count) noexcept;
+
+  /**
+   * @brief Transforms directions with w = 0, ignoring the translation.
+   */
+  void transformVectors(const mat4& m, const PointsSoA& in,
+                        const PointsSoA& out, size_t count) noexcept;
+
+  /**
+   * @brief Multiplies pairs of matrices: out[i] = a[i] * b[i].
+   */
+  void multiply(const mat4* a, const mat4* b, mat4* out,
+                size_t count) noexcept;
+
+  /**
+   * @brief Product of a chain, matrices[0] * ... * matrices[count - 1],
+   *        the identity when empty.
+   */
+  mat4 multiplyChain(const mat4* matrices, size_t count) noexcept;
+
+  /**
+   * @brief World matrices of a hierarchy: worlds[i] is locals[i] for a
+   *        root and worlds[parents[i]] * locals[i] otherwise, every chain
+   *        to a root multiplied once. Parents must precede their children.
+   */
+  void multiplyHierarchy(const mat4* locals, const uint32_t* parents,
+                         mat4* worlds, size_t count) noexcept;
+}  // namespace uranium::math
@@ -0,0 +1,187 @@
+/*******************************************************************
+ * @file   Matrix.hpp
+ * @brief  3x3 and 4x4 column-major float matrices.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include "Vector.hpp"
+
+namespace uranium::math {
+
+  struct mat4;
+  struct quat;
+
+  /**
+   * @struct mat3
+   * @brief Rotation and scale, e.g. the normal matrix. Column-major,
+   *        columns[c][r] is the element of column c and row r.
+   */
+  struct mat3 {
+    vec3 columns[3];
+
+    /**
+     * @brief The identity.
+     */
+    constexpr mat3() noexcept
+        : columns{vec3(1.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f),
+                  vec3(0.0f, 0.0f, 1.0f)} {}
+    constexpr mat3(const vec3& c0, const vec3& c1, const vec3& c2) noexcept
+        : columns{c0, c1, c2} {}
+
+    /**
+     * @brief Upper left 3x3 part of a 4x4 matrix.
+     */
+    explicit mat3(const mat4& m) noexcept;
+
+    constexpr vec3& operator[](size_t c) noexcept { return columns[c]; }
+    constexpr const vec3& operator[](size_t c) const noexcept {
+      return columns[c];
+    }
+  };
+
+  /**
+   * @struct mat4
+   * @brief Affine or projective transform, one vec4 per column so every
+   *        product is four SIMD multiply-adds. Column-major as OpenGL
+   *        expects, vectors are multiplied on the right: M * v.
+   */
+  struct alignas(16) mat4 {
+    vec4 columns[4];
+
+    /**
+     * @brief The identity.
+     */
+    constexpr mat4() noexcept
+        : columns{vec4(1.0f, 0.0f, 0.0f, 0.0f), vec4(0.0f, 1.0f, 0.0f, 0.0f),
+                  vec4(0.0f, 0.0f, 1.0f, 0.0f),
+                  vec4(0.0f, 0.0f, 0.0f, 1.0f)} {}
+    constexpr mat4(const vec4& c0, const vec4& c1, const vec4& c2,
+                   const vec4& c3) noexcept
+        : columns{c0, c1, c2, c3} {}
+
+    /**
+     * @brief Rotation and scale of m, with no translation.
+     */
+    explicit mat4(const mat3& m) noexcept;
+
+    vec4& operator[](size_t c) noexcept { return columns[c]; }
+    const vec4& operator[](size_t c) const noexcept { return columns[c]; }
+
+    static mat4 translation(const vec3& offset) noexcept;
+    static mat4 scaling(const vec3& factors) noexcept;
+    static mat4 rotation(const quat& rotation) noexcept;
+
+    /**
+     * @brief OpenGL perspective projection, depth mapped to [-1, 1].
+     *
+     * @param fovy   Vertical field of view in radians.
+     * @param aspect Width over height.
+     */
+    static mat4 perspective(float fovy, float aspect, float z_near,
+                            float z_far) noexcept;
+
+    /**
+     * @brief OpenGL orthographic projection, depth mapped to [-1, 1].
+     */
+    static mat4 orthographic(float left, float right, float bottom,
+                             float top, float z_near, float z_far) noexcept;
+
+    /**
+     * @brief View matrix of a camera at eye looking at target.
+     */
+    static mat4 lookAt(const vec3& eye, const vec3& target,
+                       const vec3& up) noexcept;
+  };
+
+  // ---------------------------------------------------------------- mat3
+
+  constexpr vec3 operator*(const mat3& m, const vec3& v) noexcept {
+    return m.columns[0] * v.x + m.columns[1] * v.y + m.columns[2] * v.z;
+  }
+
+  constexpr mat3 operator*(const mat3& a, const mat3& b) noexcept {
+    return mat3(a * b.columns[0], a * b.columns[1], a * b.columns[2]);
+  }
+
+  constexpr mat3 transpose(const mat3& m) noexcept {
+    return mat3(vec3(m[0].x, m[1].x, m[2].x), vec3(m[0].y, m[1].y, m[2].y),
+                vec3(m[0].z, m[1].z, m[2].z));
+  }
+
+  constexpr float determinant(const mat3& m) noexcept {
+    return dot(m[0], cross(m[1], m[2]));
+  }
+
+  /**
+   * @brief Inverse of m, the identity when m is singular.
+   */
+  mat3 inverse(const mat3& m) noexcept;
+
+  // ---------------------------------------------------------------- mat4
+
+  inline vec4 operator*(const mat4& m, const vec4& v) noexcept {
+#if defined(UR_MATH_SSE)
+    __m128 x = _mm_shuffle_ps(v.simd(), v.simd(), _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 y = _mm_shuffle_ps(v.simd(), v.simd(), _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 z = _mm_shuffle_ps(v.simd(), v.simd(), _MM_SHUFFLE(2, 2, 2, 2));
+    __m128 w = _mm_shuffle_ps(v.simd(), v.simd(), _MM_SHUFFLE(3, 3, 3, 3));
+    __m128 xy =
+        _mm_add_ps(_mm_mul_ps(m[0].simd(), x), _mm_mul_ps(m[1].simd(), y));
+    __m128 zw =
+        _mm_add_ps(_mm_mul_ps(m[2].simd(), z), _mm_mul_ps(m[3].simd(), w));
+    return vec4(_mm_add_ps(xy, zw));
+#else
+    return (m[0] * v.x + m[1] * v.y) + (m[2] * v.z + m[3] * v.w);
+#endif
+  }
+
+  inline mat4 operator*(const mat4& a, const mat4& b) noexcept {
+    return mat4(a * b[0], a * b[1], a * b[2], a * b[3]);
+  }
+
+  inline mat4 transpose(const mat4& m) noexcept {
+#if defined(UR_MATH_SSE)
+    __m128 c0 = m[0].simd(), c1 = m[1].simd();
+    __m128 c2 = m[2].simd(), c3 = m[3].simd();
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    return mat4(vec4(c0), vec4(c1), vec4(c2), vec4(c3));
+#else
+    return mat4(vec4(m[0].x, m[1].x, m[2].x, m[3].x),
+                vec4(m[0].y, m[1].y, m[2].y, m[3].y),
+                vec4(m[0].z, m[1].z, m[2].z, m[3].z),
+                vec4(m[0].w, m[1].w, m[2].w, m[3].w));
+#endif
+  }
+
+  /**
+   * @brief Transforms a point, w = 1, without the perspective divide.
+   */
+  inline vec3 transformPoint(const mat4& m, const vec3& p) noexcept {
+    return (m * vec4(p, 1.0f)).xyz();
+  }
+
+  /**
+   * @brief Transforms a direction, w = 0, ignoring the translation.
+   */
+  inline vec3 transformVector(const mat4& m, const vec3& v) noexcept {
+    return (m * vec4(v, 0.0f)).xyz();
+  }
+
+  float determinant(const mat4& m) noexcept;
+
+  /**
+   * @brief Inverse of m, the identity when m is singular.
+   */
+  mat4 inverse(const mat4& m) noexcept;
+
+  /**
+   * @brief Transforms normals along with m: the inverse transpose of its
+   *        3x3 part.
+   */
+  inline mat3 normalMatrix(const mat4& m) noexcept {
+    return transpose(inverse(mat3(m)));
+  }
+}  // namespace uranium::math
@@ -0,0 +1,136 @@
+/*******************************************************************
+ * @file   Quaternion.hpp
+ * @brief  Unit quaternions for rotations.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include "Matrix.hpp"
+
+namespace uranium::math {
+
+  /**
+   * @struct quat
+   * @brief Rotation as x i + y j + z k + w, in one SIMD register like a
+   *        vec4. Rotations compose right to left as matrices do: a * b
+   *        rotates by b, then by a.
+   */
+  struct alignas(16) quat {
+    float x, y, z, w;
+
+    /**
+     * @brief The identity rotation.
+     */
+    constexpr quat() noexcept : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+    constexpr quat(float x, float y, float z, float w) noexcept
+        : x(x), y(y), z(z), w(w) {}
+#if defined(UR_MATH_SSE)
+    explicit quat(__m128 lanes) noexcept { _mm_store_ps(&x, lanes); }
+
+    /**
+     * @brief The four floats as a register, x in the lowest lane.
+     */
+    __m128 simd() const noexcept { return _mm_load_ps(&x); }
+#endif
+
+    /**
+     * @brief Rotation around an axis.
+     *
+     * @param axis  Unit axis.
+     * @param angle Counter-clockwise angle in radians.
+     */
+    static quat axisAngle(const vec3& axis, float angle) noexcept;
+
+    /**
+     * @brief Rotation of a pure rotation matrix.
+     */
+    static quat fromMatrix(const mat3& m) noexcept;
+
+    constexpr vec3 xyz() const noexcept { return vec3(x, y, z); }
+  };
+
+  /**
+   * @brief Hamilton product, the rotation b followed by a.
+   */
+  inline quat operator*(const quat& a, const quat& b) noexcept {
+#if defined(UR_MATH_SSE)
+    // w1 q2 plus x1, y1 and z1 times signed shuffles of q2
+    const __m128 x_signs = _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f);
+    const __m128 y_signs = _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f);
+    const __m128 z_signs = _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f);
+
+    __m128 q = b.simd();
+    __m128 r = _mm_mul_ps(_mm_shuffle_ps(a.simd(), a.simd(), 0xFF), q);
+    __m128 wzyx = _mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 1, 2, 3));
+    __m128 zwxy = _mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 0, 3, 2));
+    __m128 yxwz = _mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 3, 0, 1));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a.simd(), a.simd(), 0x00),
+                                 _mm_mul_ps(wzyx, x_signs)));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a.simd(), a.simd(), 0x55),
+                                 _mm_mul_ps(zwxy, y_signs)));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a.simd(), a.simd(), 0xAA),
+                                 _mm_mul_ps(yxwz, z_signs)));
+    return quat(r);
+#else
+    return quat(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+                a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+#endif
+  }
+
+  /**
+   * @brief Rotates a vector by a unit quaternion.
+   */
+  constexpr vec3 operator*(const quat& q, const vec3& v) noexcept {
+    // v + 2 w (u x v) + 2 u x (u x v), cheaper than q v q*
+    vec3 u = q.xyz();
+    vec3 t = cross(u, v) * 2.0f;
+    return v + t * q.w + cross(u, t);
+  }
+
+  constexpr bool operator==(const quat& a, const quat& b) noexcept {
+    return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+  }
+
+  inline float dot(const quat& a, const quat& b) noexcept {
+#if defined(UR_MATH_SSE)
+    return dot(vec4(a.simd()), vec4(b.simd()));
+#else
+    return (a.x * b.x + a.y * b.y) + (a.z * b.z + a.w * b.w);
+#endif
+  }
+
+  /**
+   * @brief Inverse of a unit quaternion.
+   */
+  constexpr quat conjugate(const quat& q) noexcept {
+    return quat(-q.x, -q.y, -q.z, q.w);
+  }
+
+  /**
+   * @brief Inverse of any non-zero quaternion.
+   */
+  quat inverse(const quat& q) noexcept;
+
+  /**
+   * @brief Unit quaternion of the same rotation, the identity when q is
+   *        too short to have one.
+   */
+  quat normalize(const quat& q) noexcept;
+
+  /**
+   * @brief Normalized linear blend along the shortest arc. Not constant
+   *        speed, cheaper than slerp for close rotations.
+   */
+  quat nlerp(const quat& a, const quat& b, float t) noexcept;
+
+  /**
+   * @brief Constant speed blend along the shortest arc.
+   */
+  quat slerp(const quat& a, const quat& b, float t) noexcept;
+
+  mat3 toMat3(const quat& q) noexcept;
+}  // namespace uranium::math
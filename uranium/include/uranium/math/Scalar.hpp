@@ -0,0 +1,41 @@
+/*******************************************************************
+ * @file   Scalar.hpp
+ * @brief  Constants and helpers on plain floats.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <cmath>
+
+namespace uranium::math {
+
+  static inline constexpr float PI = 3.14159265358979323846f;
+  static inline constexpr float TWO_PI = 2.0f * PI;
+  static inline constexpr float HALF_PI = 0.5f * PI;
+
+  // Tolerance of the comparisons and the degenerate cases
+  static inline constexpr float EPSILON = 1e-6f;
+
+  constexpr float radians(float degrees) noexcept {
+    return degrees * (PI / 180.0f);
+  }
+
+  constexpr float degrees(float radians) noexcept {
+    return radians * (180.0f / PI);
+  }
+
+  constexpr float lerp(float a, float b, float t) noexcept {
+    return a + (b - a) * t;
+  }
+
+  /**
+   * @brief Compares two floats within a tolerance relative to their size.
+   */
+  inline bool nearlyEqual(float a, float b,
+                          float tolerance = EPSILON) noexcept {
+    float scale = std::fmax(1.0f, std::fmax(std::fabs(a), std::fabs(b)));
+    return std::fabs(a - b) <= tolerance * scale;
+  }
+}  // namespace uranium::math
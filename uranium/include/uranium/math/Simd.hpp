@@ -0,0 +1,41 @@
+/*******************************************************************
+ * @file   Simd.hpp
+ * @brief  Instruction set of the math types, chosen at compile time.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <string_view>
+
+// SSE2 is part of every x86-64 target, AVX only when the compiler is told
+// (-mavx, /arch:AVX). UR_MATH_SCALAR forces the portable code everywhere,
+// e.g. to compare results or on other architectures
+#if !defined(UR_MATH_SCALAR) &&                   \
+    (defined(__SSE2__) || defined(_M_X64) ||      \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define UR_MATH_SSE
+#endif
+
+#if defined(UR_MATH_SSE) && defined(__AVX__)
+#define UR_MATH_AVX
+#endif
+
+#if defined(UR_MATH_SSE)
+#include <immintrin.h>
+#endif
+
+namespace uranium::math {
+
+  /**
+   * @brief Instruction set the math was compiled for.
+   */
+#if defined(UR_MATH_AVX)
+  static inline constexpr std::string_view SIMD = "AVX";
+#elif defined(UR_MATH_SSE)
+  static inline constexpr std::string_view SIMD = "SSE2";
+#else
+  static inline constexpr std::string_view SIMD = "Scalar";
+#endif
+}  // namespace uranium::math
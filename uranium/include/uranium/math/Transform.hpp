@@ -0,0 +1,62 @@
+/*******************************************************************
+ * @file   Transform.hpp
+ * @brief  Affine transform as translation, rotation and scale.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include "Quaternion.hpp"
+
+namespace uranium::math {
+
+  /**
+   * @struct Transform
+   * @brief Scales, then rotates, then translates. Cheaper to store, blend
+   *        and invert than a mat4, which toMatrix() builds for rendering.
+   *
+   *        Composition and inversion keep the three parts separate, so
+   *        they are exact only for uniform scales; a non-uniform scale
+   *        under a rotation shears, which only a mat4 can express.
+   */
+  struct Transform {
+    vec3 translation;
+    quat rotation;
+    vec3 scale;
+
+    /**
+     * @brief The identity.
+     */
+    constexpr Transform() noexcept
+        : translation(), rotation(), scale(1.0f) {}
+    constexpr Transform(const vec3& translation, const quat& rotation,
+                        const vec3& scale = vec3(1.0f)) noexcept
+        : translation(translation), rotation(rotation), scale(scale) {}
+
+    constexpr vec3 transformPoint(const vec3& p) const noexcept {
+      return rotation * (p * scale) + translation;
+    }
+
+    constexpr vec3 transformVector(const vec3& v) const noexcept {
+      return rotation * (v * scale);
+    }
+
+    mat4 toMatrix() const noexcept;
+  };
+
+  /**
+   * @brief The transform child followed by parent, e.g. a local transform
+   *        into world space.
+   */
+  Transform operator*(const Transform& parent,
+                      const Transform& child) noexcept;
+
+  Transform inverse(const Transform& t) noexcept;
+
+  /**
+   * @brief Blends translations and scales linearly, rotations with slerp.
+   */
+  Transform interpolate(const Transform& a, const Transform& b,
+                        float t) noexcept;
+}  // namespace uranium::math
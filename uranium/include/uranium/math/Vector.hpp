@@ -0,0 +1,293 @@
+/*******************************************************************
+ * @file   Vector.hpp
+ * @brief  2, 3 and 4 component float vectors.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include "Scalar.hpp"
+#include "Simd.hpp"
+
+namespace uranium::math {
+
+  /**
+   * @struct vec2
+   * @brief Two floats, e.g. a screen position or a texture coordinate.
+   */
+  struct vec2 {
+    float x, y;
+
+    constexpr vec2() noexcept : x(0.0f), y(0.0f) {}
+    constexpr explicit vec2(float s) noexcept : x(s), y(s) {}
+    constexpr vec2(float x, float y) noexcept : x(x), y(y) {}
+
+    float& operator[](size_t i) noexcept { return (&x)[i]; }
+    float operator[](size_t i) const noexcept { return (&x)[i]; }
+
+    constexpr vec2& operator+=(const vec2& v) noexcept {
+      x += v.x, y += v.y;
+      return *this;
+    }
+    constexpr vec2& operator-=(const vec2& v) noexcept {
+      x -= v.x, y -= v.y;
+      return *this;
+    }
+    constexpr vec2& operator*=(float s) noexcept {
+      x *= s, y *= s;
+      return *this;
+    }
+    constexpr vec2& operator/=(float s) noexcept { return *this *= 1.0f / s; }
+  };
+
+  /**
+   * @struct vec3
+   * @brief Three floats, packed so arrays of them match vertex layouts.
+   *        Single vec3 operations stay scalar, a 12 byte vector gains
+   *        little from SIMD; transform many of them with Batch.hpp.
+   */
+  struct vec3 {
+    float x, y, z;
+
+    constexpr vec3() noexcept : x(0.0f), y(0.0f), z(0.0f) {}
+    constexpr explicit vec3(float s) noexcept : x(s), y(s), z(s) {}
+    constexpr vec3(float x, float y, float z) noexcept : x(x), y(y), z(z) {}
+    constexpr vec3(const vec2& v, float z) noexcept : x(v.x), y(v.y), z(z) {}
+
+    float& operator[](size_t i) noexcept { return (&x)[i]; }
+    float operator[](size_t i) const noexcept { return (&x)[i]; }
+
+    constexpr vec3& operator+=(const vec3& v) noexcept {
+      x += v.x, y += v.y, z += v.z;
+      return *this;
+    }
+    constexpr vec3& operator-=(const vec3& v) noexcept {
+      x -= v.x, y -= v.y, z -= v.z;
+      return *this;
+    }
+    constexpr vec3& operator*=(const vec3& v) noexcept {
+      x *= v.x, y *= v.y, z *= v.z;
+      return *this;
+    }
+    constexpr vec3& operator*=(float s) noexcept {
+      x *= s, y *= s, z *= s;
+      return *this;
+    }
+    constexpr vec3& operator/=(float s) noexcept { return *this *= 1.0f / s; }
+  };
+
+  /**
+   * @struct vec4
+   * @brief Four floats in one SIMD register, e.g. a homogeneous point or
+   *        a matrix column. The floats are plain members, and move in and
+   *        out of registers through aligned loads and stores, so no build
+   *        relies on type punning.
+   */
+  struct alignas(16) vec4 {
+    float x, y, z, w;
+
+    constexpr vec4() noexcept : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+    constexpr explicit vec4(float s) noexcept : x(s), y(s), z(s), w(s) {}
+    constexpr vec4(float x, float y, float z, float w) noexcept
+        : x(x), y(y), z(z), w(w) {}
+    constexpr vec4(const vec3& v, float w) noexcept
+        : x(v.x), y(v.y), z(v.z), w(w) {}
+#if defined(UR_MATH_SSE)
+    explicit vec4(__m128 lanes) noexcept { _mm_store_ps(&x, lanes); }
+
+    /**
+     * @brief The four floats as a register, x in the lowest lane.
+     */
+    __m128 simd() const noexcept { return _mm_load_ps(&x); }
+#endif
+
+    float& operator[](size_t i) noexcept { return (&x)[i]; }
+    float operator[](size_t i) const noexcept { return (&x)[i]; }
+
+    constexpr vec3 xyz() const noexcept { return vec3(x, y, z); }
+
+    vec4& operator+=(const vec4& v) noexcept;
+    vec4& operator-=(const vec4& v) noexcept;
+    vec4& operator*=(const vec4& v) noexcept;
+    vec4& operator*=(float s) noexcept;
+    vec4& operator/=(float s) noexcept { return *this *= 1.0f / s; }
+  };
+
+  static_assert(sizeof(vec2) == 8 && sizeof(vec3) == 12 &&
+                    sizeof(vec4) == 16,
+                "Vectors must stay packed to match GPU layouts.");
+
+  // ---------------------------------------------------------------- vec2
+
+  constexpr vec2 operator+(vec2 a, const vec2& b) noexcept { return a += b; }
+  constexpr vec2 operator-(vec2 a, const vec2& b) noexcept { return a -= b; }
+  constexpr vec2 operator*(vec2 v, float s) noexcept { return v *= s; }
+  constexpr vec2 operator*(float s, vec2 v) noexcept { return v *= s; }
+  constexpr vec2 operator/(vec2 v, float s) noexcept { return v /= s; }
+  constexpr vec2 operator-(const vec2& v) noexcept { return vec2(-v.x, -v.y); }
+  constexpr bool operator==(const vec2& a, const vec2& b) noexcept {
+    return a.x == b.x && a.y == b.y;
+  }
+
+  constexpr float dot(const vec2& a, const vec2& b) noexcept {
+    return a.x * b.x + a.y * b.y;
+  }
+
+  // ---------------------------------------------------------------- vec3
+
+  constexpr vec3 operator+(vec3 a, const vec3& b) noexcept { return a += b; }
+  constexpr vec3 operator-(vec3 a, const vec3& b) noexcept { return a -= b; }
+  constexpr vec3 operator*(vec3 a, const vec3& b) noexcept { return a *= b; }
+  constexpr vec3 operator*(vec3 v, float s) noexcept { return v *= s; }
+  constexpr vec3 operator*(float s, vec3 v) noexcept { return v *= s; }
+  constexpr vec3 operator/(vec3 v, float s) noexcept { return v /= s; }
+  constexpr vec3 operator-(const vec3& v) noexcept {
+    return vec3(-v.x, -v.y, -v.z);
+  }
+  constexpr bool operator==(const vec3& a, const vec3& b) noexcept {
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+  }
+
+  constexpr float dot(const vec3& a, const vec3& b) noexcept {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+  }
+
+  constexpr vec3 cross(const vec3& a, const vec3& b) noexcept {
+    return vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                a.x * b.y - a.y * b.x);
+  }
+
+  constexpr vec3 min(const vec3& a, const vec3& b) noexcept {
+    return vec3(a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y,
+                a.z < b.z ? a.z : b.z);
+  }
+
+  constexpr vec3 max(const vec3& a, const vec3& b) noexcept {
+    return vec3(a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y,
+                a.z > b.z ? a.z : b.z);
+  }
+
+  // ---------------------------------------------------------------- vec4
+
+#if defined(UR_MATH_SSE)
+  inline vec4& vec4::operator+=(const vec4& v) noexcept {
+    *this = vec4(_mm_add_ps(simd(), v.simd()));
+    return *this;
+  }
+  inline vec4& vec4::operator-=(const vec4& v) noexcept {
+    *this = vec4(_mm_sub_ps(simd(), v.simd()));
+    return *this;
+  }
+  inline vec4& vec4::operator*=(const vec4& v) noexcept {
+    *this = vec4(_mm_mul_ps(simd(), v.simd()));
+    return *this;
+  }
+  inline vec4& vec4::operator*=(float s) noexcept {
+    *this = vec4(_mm_mul_ps(simd(), _mm_set1_ps(s)));
+    return *this;
+  }
+
+  inline vec4 operator-(const vec4& v) noexcept {
+    return vec4(_mm_xor_ps(v.simd(), _mm_set1_ps(-0.0f)));
+  }
+
+  inline float dot(const vec4& a, const vec4& b) noexcept {
+    // Horizontal sum with SSE2 shuffles, _mm_dp_ps needs SSE4.1
+    __m128 product = _mm_mul_ps(a.simd(), b.simd());
+    __m128 swapped =
+        _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 sums = _mm_add_ps(product, swapped);
+    swapped = _mm_movehl_ps(swapped, sums);
+    return _mm_cvtss_f32(_mm_add_ss(sums, swapped));
+  }
+
+  inline vec4 min(const vec4& a, const vec4& b) noexcept {
+    return vec4(_mm_min_ps(a.simd(), b.simd()));
+  }
+
+  inline vec4 max(const vec4& a, const vec4& b) noexcept {
+    return vec4(_mm_max_ps(a.simd(), b.simd()));
+  }
+#else
+  inline vec4& vec4::operator+=(const vec4& v) noexcept {
+    x += v.x, y += v.y, z += v.z, w += v.w;
+    return *this;
+  }
+  inline vec4& vec4::operator-=(const vec4& v) noexcept {
+    x -= v.x, y -= v.y, z -= v.z, w -= v.w;
+    return *this;
+  }
+  inline vec4& vec4::operator*=(const vec4& v) noexcept {
+    x *= v.x, y *= v.y, z *= v.z, w *= v.w;
+    return *this;
+  }
+  inline vec4& vec4::operator*=(float s) noexcept {
+    x *= s, y *= s, z *= s, w *= s;
+    return *this;
+  }
+
+  inline vec4 operator-(const vec4& v) noexcept {
+    return vec4(-v.x, -v.y, -v.z, -v.w);
+  }
+
+  inline float dot(const vec4& a, const vec4& b) noexcept {
+    return (a.x * b.x + a.y * b.y) + (a.z * b.z + a.w * b.w);
+  }
+
+  inline vec4 min(const vec4& a, const vec4& b) noexcept {
+    return vec4(a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y,
+                a.z < b.z ? a.z : b.z, a.w < b.w ? a.w : b.w);
+  }
+
+  inline vec4 max(const vec4& a, const vec4& b) noexcept {
+    return vec4(a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y,
+                a.z > b.z ? a.z : b.z, a.w > b.w ? a.w : b.w);
+  }
+#endif
+
+  inline vec4 operator+(vec4 a, const vec4& b) noexcept { return a += b; }
+  inline vec4 operator-(vec4 a, const vec4& b) noexcept { return a -= b; }
+  inline vec4 operator*(vec4 a, const vec4& b) noexcept { return a *= b; }
+  inline vec4 operator*(vec4 v, float s) noexcept { return v *= s; }
+  inline vec4 operator*(float s, vec4 v) noexcept { return v *= s; }
+  inline vec4 operator/(vec4 v, float s) noexcept { return v /= s; }
+  inline bool operator==(const vec4& a, const vec4& b) noexcept {
+    return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+  }
+
+  // ------------------------------------------------------------- common
+
+  template <typename Vector>
+  inline float lengthSquared(const Vector& v) noexcept {
+    return dot(v, v);
+  }
+
+  template <typename Vector>
+  inline float length(const Vector& v) noexcept {
+    return std::sqrt(dot(v, v));
+  }
+
+  template <typename Vector>
+  inline float distance(const Vector& a, const Vector& b) noexcept {
+    return length(a - b);
+  }
+
+  /**
+   * @brief Unit vector of the same direction, the vector itself when it
+   *        is too short to have one.
+   */
+  template <typename Vector>
+  inline Vector normalize(const Vector& v) noexcept {
+    float squared = dot(v, v);
+    return squared > EPSILON * EPSILON ? v * (1.0f / std::sqrt(squared)) : v;
+  }
+
+  template <typename Vector>
+  inline Vector lerp(const Vector& a, const Vector& b, float t) noexcept {
+    return a + (b - a) * t;
+  }
+}  // namespace uranium::math
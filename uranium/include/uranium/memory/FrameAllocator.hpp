@@ -0,0 +1,72 @@
+/*******************************************************************
+ * @file   FrameAllocator.hpp
+ * @brief  Double-buffered linear allocator for per-frame data.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <cstddef>
+
+#include "IAllocator.hpp"
+#include "LinearAllocator.hpp"
+
+namespace uranium::memory {
+
+  /**
+   * @class FrameAllocator
+   * @brief Transient memory released by the frame loop instead of freed.
+   *
+   *        Allocations go to the page of the current frame. beginFrame()
+   *        makes the other page current after resetting it, so memory
+   *        allocated in a frame stays valid through the next one: data a
+   *        frame produces can be consumed by the following frame.
+   *
+   *        allocate() is safe from any thread. beginFrame() must be called
+   *        by the owner while no other thread allocates.
+   */
+  class FrameAllocator final : UR_IMPLEMENTS IAllocator {
+  public:
+    /**
+     * @brief Allocates both pages.
+     *
+     * @param capacity Size of each page in bytes.
+     */
+    explicit FrameAllocator(
+        size_t capacity = LinearAllocator::DEFAULT_CAPACITY);
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    void* allocate(size_t size, size_t alignment, Tag tag) override {
+      return pages[active].allocate(size, alignment, tag);
+    }
+
+    /**
+     * @brief Does nothing, the memory is released two frames later.
+     */
+    void deallocate(void*, size_t, Tag) noexcept override {}
+
+    /**
+     * @brief Bytes in use of both pages.
+     */
+    size_t bytesOf(Tag tag) const noexcept override;
+
+    /**
+     * @brief Releases the page of the frame before the last one and makes
+     *        it current. Called once at the start of every frame.
+     */
+    void beginFrame() noexcept;
+
+    /**
+     * @brief Page of the current frame, to mark() and rewind() scratch
+     *        memory inside the frame.
+     */
+    LinearAllocator& current() noexcept { return pages[active]; }
+
+  private:
+    LinearAllocator pages[2];
+    uint32_t active;
+  };
+}  // namespace uranium::memory
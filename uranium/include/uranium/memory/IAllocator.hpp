@@ -0,0 +1,73 @@
+/*******************************************************************
+ * @file   IAllocator.hpp
+ * @brief  Interface of the engine allocators, with per-category tagging.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "uranium/core/Logger.hpp"
+#include "uranium/core/Types.hpp"
+
+namespace uranium::memory {
+
+  /**
+   * @brief Subsystem an allocation is made for. The log categories double
+   *        as memory tags, so usage reads the same way as the logs.
+   */
+  using Tag = core::LogCategory;
+
+  // Number of tags, the size of every per-tag table
+  static inline constexpr size_t TAG_COUNT =
+      static_cast<size_t>(Tag::COUNT);
+
+  // Alignment used when the caller has no stricter requirement
+  static inline constexpr size_t DEFAULT_ALIGNMENT = alignof(std::max_align_t);
+
+  /**
+   * @class IAllocator
+   * @brief Allocator of the engine. Every allocation names the tag it is
+   *        made for, and the allocator keeps the bytes in use per tag.
+   */
+  UR_INTERFACE IAllocator {
+  public:
+    virtual ~IAllocator() noexcept = default;
+
+    /**
+     * @brief Allocates a block of memory.
+     *
+     * @param size      Bytes requested.
+     * @param alignment Power of two the address is a multiple of.
+     * @param tag       Subsystem the memory is accounted to.
+     * @return The block, or nullptr if the request cannot be served.
+     */
+    virtual void* allocate(size_t size, size_t alignment, Tag tag) = 0;
+
+    /**
+     * @brief Returns a block. Size and tag must match the allocation.
+     */
+    virtual void deallocate(void* ptr, size_t size, Tag tag) noexcept = 0;
+
+    /**
+     * @brief Bytes in use accounted to a tag.
+     */
+    virtual size_t bytesOf(Tag tag) const noexcept = 0;
+
+    /**
+     * @brief Bytes in use over every tag.
+     */
+    size_t bytes() const noexcept;
+
+    /**
+     * @brief Logs the bytes in use of every tag that has some.
+     *
+     * @param name Shown in front of the usage.
+     */
+    void logUsage(std::string_view name) const;
+  };
+}  // namespace uranium::memory
@@ -0,0 +1,121 @@
+/*******************************************************************
+ * @file   LinearAllocator.hpp
+ * @brief  Bump allocator released in bulk, with stack-like markers.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include "IAllocator.hpp"
+
+namespace uranium::memory {
+
+  /**
+   * @class LinearAllocator
+   * @brief Hands out memory by bumping an offset into one buffer. Blocks
+   *        are never freed one by one: reset() releases all of them, and
+   *        rewind() releases everything allocated since a mark(), which
+   *        makes it usable as a stack allocator.
+   *
+   *        allocate() is lock-free and safe from any thread. Requests that
+   *        do not fit are served from the heap until the next reset(),
+   *        which then grows the buffer to the size the frame needed.
+   *        mark(), rewind() and reset() must only be called by the owner,
+   *        while no other thread allocates.
+   */
+  class LinearAllocator final : UR_IMPLEMENTS IAllocator {
+  public:
+    static inline constexpr size_t DEFAULT_CAPACITY = 1024 * 1024;
+
+    /**
+     * @struct Marker
+     * @brief Position of the allocator, to rewind() to.
+     */
+    struct Marker {
+      size_t offset;
+      std::array<size_t, TAG_COUNT> tagged;
+    };
+
+  public:
+    /**
+     * @brief Allocates the buffer.
+     *
+     * @param capacity Size of the buffer in bytes.
+     */
+    explicit LinearAllocator(size_t capacity = DEFAULT_CAPACITY);
+    ~LinearAllocator() noexcept override;
+
+    LinearAllocator(const LinearAllocator&) = delete;
+    LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+    void* allocate(size_t size, size_t alignment, Tag tag) override;
+
+    /**
+     * @brief Does nothing, the memory is released by rewind() or reset().
+     */
+    void deallocate(void*, size_t, Tag) noexcept override {}
+
+    size_t bytesOf(Tag tag) const noexcept override;
+
+    /**
+     * @brief Current position, everything allocated after it is released
+     *        by rewinding to it.
+     */
+    Marker mark() const noexcept;
+
+    /**
+     * @brief Releases everything allocated since the marker. Blocks taken
+     *        from the heap meanwhile are kept until reset(). The marker
+     *        must come from mark() on this allocator since its last reset,
+     *        and not be older than a marker already rewound to.
+     */
+    void rewind(const Marker& marker) noexcept;
+
+    /**
+     * @brief Releases every allocation, growing the buffer first if the
+     *        last use outgrew it.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Bytes of the buffer used, alignment padding included.
+     */
+    size_t used() const noexcept;
+
+    /**
+     * @brief Size of the buffer in bytes.
+     */
+    size_t capacity() const noexcept;
+
+  private:
+    /**
+     * @struct Overflow
+     * @brief Header of a block taken from the heap once the buffer is
+     *        exhausted. The allocation follows the header.
+     */
+    struct Overflow {
+      Overflow* next;
+    };
+
+    void* spill(size_t size, size_t alignment, Tag tag);
+    void release() noexcept;
+
+  private:
+    std::byte* buffer;
+    size_t buffer_size;
+    alignas(UR_CACHE_LINE) std::atomic<size_t> offset;
+    std::array<std::atomic<size_t>, TAG_COUNT> tagged;
+
+    // Largest offset reached since the last reset, may exceed the buffer
+    size_t peak;
+
+    std::mutex grow;
+    Overflow* overflow;
+  };
+}  // namespace uranium::memory
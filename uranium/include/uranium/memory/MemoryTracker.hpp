@@ -0,0 +1,138 @@
+/*******************************************************************
+ * @file   MemoryTracker.hpp
+ * @brief  Live memory usage and budgets per subsystem.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "IAllocator.hpp"
+
+/*
+ * @brief UR_TRACK_MEMORY replaces the global operator new and delete to
+ *        account every heap allocation to the tag of the innermost
+ *        MemoryScope of the thread. Set by the URANIUM_TRACK_MEMORY option,
+ *        on by default in Debug builds only: every allocation then carries
+ *        a 16 byte header and looks up its thread scope. The engine
+ *        allocators are tracked either way.
+ */
+
+namespace uranium::memory {
+
+  /**
+   * @struct TagStats
+   * @brief Memory accounted to one tag.
+   */
+  struct TagStats {
+    int64_t heap = 0;          // Live bytes from the global heap
+    int64_t arena = 0;         // Live bytes from the engine allocators
+    int64_t peak = 0;          // Highest heap + arena seen by update()
+    uint64_t allocations = 0;  // Allocations since the start
+    double rate = 0.0;         // Allocations per second, over the last update
+    size_t budget = 0;         // Bytes allowed, 0 is unlimited
+
+    int64_t live() const noexcept { return heap + arena; }
+  };
+
+  /**
+   * @class MemoryTracker
+   * @brief Counts the live bytes, peak and allocation rate of every tag.
+   *
+   *        Every thread counts into its own counters, which only it writes,
+   *        so an allocation costs no atomic read-modify-write nor shared
+   *        cache line. Readers sum the counters of every thread, and those
+   *        of exited threads are folded into a shared total.
+   *
+   *        update() samples the totals once per frame: it keeps the peaks
+   *        and rates, warns about the tags over their budget and dumps the
+   *        usage periodically. Peaks are only as fine as the sampling.
+   *
+   *        The memory of the engine allocators is counted under MEMORY on
+   *        the heap, and again under the tag of every allocation made in it
+   *        as arena bytes.
+   */
+  class MemoryTracker final {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+  public:
+    /**
+     * @brief Counts an allocation of an engine allocator.
+     */
+    static void allocated(Tag tag, size_t bytes) noexcept;
+
+    /**
+     * @brief Counts the release of memory of an engine allocator.
+     */
+    static void freed(Tag tag, size_t bytes) noexcept;
+
+    /**
+     * @brief Usage of a tag, live bytes as of now, peak and rate as of the
+     *        last update().
+     */
+    static TagStats stats(Tag tag) noexcept;
+
+    /**
+     * @brief Sets the bytes a tag may use before update() warns.
+     *
+     * @param bytes Budget, 0 removes it.
+     */
+    static void setBudget(Tag tag, size_t bytes) noexcept;
+
+    /**
+     * @brief Sets how often update() logs the usage of every tag.
+     *
+     * @param interval Time between dumps, 0 disables them.
+     */
+    static void setDumpInterval(Clock::duration interval) noexcept;
+
+    /**
+     * @brief Samples peaks and rates, checks the budgets and dumps when
+     *        due. Called once per frame by the main loop.
+     */
+    static void update();
+
+    /**
+     * @brief Logs the usage of every tag that has any.
+     */
+    static void dump();
+
+    /**
+     * @brief Whether the global heap is tracked in this build.
+     */
+    static constexpr bool tracksHeap() noexcept {
+#if defined(UR_TRACK_MEMORY)
+      return true;
+#else
+      return false;
+#endif
+    }
+  };
+
+  /**
+   * @class MemoryScope
+   * @brief Accounts the heap allocations of the current thread to a tag
+   *        for its lifetime. Scopes nest.
+   */
+  class MemoryScope final {
+  public:
+    explicit MemoryScope(Tag tag) noexcept;
+    ~MemoryScope() noexcept;
+
+    MemoryScope(const MemoryScope&) = delete;
+    MemoryScope& operator=(const MemoryScope&) = delete;
+
+    /**
+     * @brief Tag of the innermost scope of the thread, NONE outside any.
+     */
+    static Tag current() noexcept;
+
+  private:
+    Tag previous;
+  };
+}  // namespace uranium::memory
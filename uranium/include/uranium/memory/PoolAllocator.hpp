@@ -0,0 +1,109 @@
+/*******************************************************************
+ * @file   PoolAllocator.hpp
+ * @brief  Allocator of fixed-size blocks with constant-time free.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "IAllocator.hpp"
+
+namespace uranium::memory {
+
+  /**
+   * @class PoolAllocator
+   * @brief Serves blocks of one size from slabs of contiguous blocks. Free
+   *        blocks are linked through their own memory, so allocating and
+   *        freeing are a pop and a push on that list.
+   *
+   *        When every block is taken another slab is added, slabs are only
+   *        returned to the heap by the destructor. Not thread-safe, a pool
+   *        belongs to one thread at a time.
+   */
+  class PoolAllocator final : UR_IMPLEMENTS IAllocator {
+  public:
+    static inline constexpr size_t DEFAULT_BLOCKS_PER_SLAB = 256;
+
+  public:
+    /**
+     * @brief Allocates the first slab.
+     *
+     * @param block_size      Largest allocation served.
+     * @param alignment       Alignment of every block.
+     * @param blocks_per_slab Blocks added each time the pool runs out.
+     */
+    explicit PoolAllocator(size_t block_size,
+                           size_t alignment = DEFAULT_ALIGNMENT,
+                           size_t blocks_per_slab = DEFAULT_BLOCKS_PER_SLAB);
+    ~PoolAllocator() noexcept override;
+
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    /**
+     * @brief Takes a block.
+     *
+     * @return The block, or nullptr if size or alignment exceed the ones
+     *         of the pool.
+     */
+    void* allocate(size_t size, size_t alignment, Tag tag) override;
+
+    void deallocate(void* ptr, size_t size, Tag tag) noexcept override;
+
+    /**
+     * @brief Bytes of the blocks in use, a whole block per allocation.
+     */
+    size_t bytesOf(Tag tag) const noexcept override;
+
+    /**
+     * @brief Size of a block, the requested one rounded up to alignment.
+     */
+    size_t blockSize() const noexcept;
+
+    /**
+     * @brief Blocks over every slab, free or not.
+     */
+    size_t blockCount() const noexcept;
+
+    /**
+     * @brief Blocks ready to be allocated without adding a slab.
+     */
+    size_t freeCount() const noexcept;
+
+  private:
+    /**
+     * @struct Slab
+     * @brief Header of a slab, its blocks follow at the next multiple of
+     *        the alignment.
+     */
+    struct Slab {
+      Slab* next;
+    };
+
+    /**
+     * @struct FreeBlock
+     * @brief A free block, holding the link to the next free one.
+     */
+    struct FreeBlock {
+      FreeBlock* next;
+    };
+
+    void addSlab();
+
+  private:
+    size_t block_size;
+    size_t alignment;
+    size_t blocks_per_slab;
+
+    Slab* slabs;
+    FreeBlock* free_list;
+    size_t blocks;
+    size_t available;
+
+    std::array<size_t, TAG_COUNT> tagged;
+  };
+}  // namespace uranium::memory
@@ -0,0 +1,75 @@
+/*******************************************************************
+ * @file   StdAllocator.hpp
+ * @brief  Adapter letting standard containers use the engine allocators.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include "FrameAllocator.hpp"
+#include "IAllocator.hpp"
+
+namespace uranium::memory {
+
+  /**
+   * @class StdAllocator
+   * @brief Standard allocator forwarding to an engine allocator, with the
+   *        tag every allocation of the container is accounted to.
+   *
+   *        Naming the concrete allocator type lets the calls be resolved
+   *        statically, IAllocator works with any of them.
+   *
+   * @tparam T         Element type.
+   * @tparam Allocator Engine allocator the memory comes from.
+   */
+  template <typename T, typename Allocator = IAllocator>
+  class StdAllocator {
+  public:
+    using value_type = T;
+
+  public:
+    StdAllocator(Allocator& allocator, Tag tag) noexcept
+        : allocator(&allocator), tag(tag) {}
+
+    template <typename U>
+    StdAllocator(const StdAllocator<U, Allocator>& other) noexcept
+        : allocator(other.allocator), tag(other.tag) {}
+
+    T* allocate(size_t count) {
+      void* memory = allocator->allocate(count * sizeof(T), alignof(T), tag);
+      if (!memory) {
+        throw std::bad_alloc();
+      }
+      return static_cast<T*>(memory);
+    }
+
+    void deallocate(T* ptr, size_t count) noexcept {
+      allocator->deallocate(ptr, count * sizeof(T), tag);
+    }
+
+    template <typename U>
+    bool operator==(const StdAllocator<U, Allocator>& other) const noexcept {
+      return allocator == other.allocator;
+    }
+
+  private:
+    template <typename U, typename A>
+    friend class StdAllocator;
+
+    Allocator* allocator;
+    Tag tag;
+  };
+
+  /**
+   * @brief Vector living in frame memory, valid until the end of the next
+   *        frame. Growing it leaves the old storage behind until then, so
+   *        reserve() the expected size first.
+   */
+  template <typename T>
+  using FrameVector = std::vector<T, StdAllocator<T, FrameAllocator>>;
+}  // namespace uranium::memory
@@ -0,0 +1,51 @@
+/*********************************************************************
+ * @file   HeadlessApp.hpp
+ * @brief  Application without a window system, for automated runs.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *********************************************************************/
+#pragma once
+
+#include "HeadlessDisplay.hpp"
+#include "uranium/core/App.hpp"
+
+namespace uranium::platform::headless {
+
+  /**
+   * @class HeadlessApp
+   * @brief Runs the main loop with a HeadlessDisplay and no monitor, so the
+   *        simulation and the CPU side of every frame can be timed on
+   *        machines without a screen. Pair it with --headless so the loop
+   *        runs one tick per frame uncapped.
+   */
+  UR_ABSTRACT_CLASS HeadlessApp : UR_EXTENDS core::IApp {
+  public:
+    explicit HeadlessApp(const core::IDisplay::Properties& properties =
+                             core::IDisplay::DEFAULT) noexcept;
+
+    /**
+     * @brief There are no monitors without a window system.
+     *
+     * @return nullptr
+     */
+    const core::IMonitor* primaryMonitor() override;
+
+    /**
+     * @brief There are no monitors without a window system.
+     *
+     * @return nullptr
+     */
+    const core::IMonitor* selectMonitor(uint32_t selection) override;
+
+  protected:
+    /**
+     * @brief Keeps running until the display is closed.
+     */
+    bool pollEvents() override;
+
+  protected:
+    HeadlessDisplay display;
+  };
+
+}  // namespace uranium::platform::headless
@@ -0,0 +1,77 @@
+/*********************************************************************
+ * @file   HeadlessDisplay.hpp
+ * @brief  Display without a window system, for automated runs.
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *********************************************************************/
+#pragma once
+
+#include "uranium/core/IDisplay.hpp"
+
+namespace uranium::platform::headless {
+
+  /**
+   * @class HeadlessDisplay
+   * @brief A display that only keeps its properties. Every call validates
+   *        its arguments and updates the properties as a window would, so
+   *        code driving a display runs unchanged on machines without a
+   *        screen, e.g. in continuous integration.
+   */
+  UR_ABSTRACT_CLASS HeadlessDisplay final : UR_EXTENDS core::IDisplay {
+  public:
+    /**
+     * @brief Constructor for HeadlessDisplay.
+     * @param properties Configuration properties for the display.
+     */
+    explicit HeadlessDisplay(
+        const core::IDisplay::Properties& properties) noexcept;
+
+    /**
+     * @brief Marks the display as closed.
+     */
+    virtual void close() override;
+
+    /**
+     * @brief There are no events, only tells if close() was called.
+     */
+    virtual bool pollEvents() override;
+
+    /**
+     * @brief Replaces every property of the display.
+     * @param properties New properties for the display.
+     */
+    virtual void reload(const core::IDisplay::Properties& properties) override;
+
+    virtual void setTitle(const std::string& title) override;
+    virtual void setIcon(const std::string& icon_path) override;
+    virtual void resize(uint32_t width, uint32_t height) override;
+
+    /**
+     * @brief Sets the display mode, fullscreen needs no monitor here.
+     */
+    virtual void setMode(core::IMonitor * monitor, Mode mode) override;
+
+    virtual void setResolution(Resolution resolution) override;
+    virtual void setResolution(uint32_t width, uint32_t height) override;
+    virtual void setOpacity(uint8_t opacity) override;
+    virtual void setVisible(bool visible) override;
+    virtual void setPosition(int32_t xpos, int32_t ypos) override;
+
+    /**
+     * @brief Does nothing, there is no screen to center on.
+     */
+    virtual void center(const core::IMonitor& monitor) override;
+
+    virtual void setAntialiasLevel(uint32_t antialias_level) override;
+    virtual void enableVsync(bool enable) override;
+
+    /**
+     * @brief Do nothing, there is no window to act on.
+     */
+    virtual void focus() override;
+    virtual void restore() override;
+    virtual void requestAttention() override;
+  };
+
+}  // namespace uranium::platform::headless
@@ -7,13 +7,26 @@
  *********************************************************************/
 #pragma once
 
+#include <memory>
+
+#include "OpenGLDisplay.hpp"
 #include "uranium/core/App.hpp"
 
 namespace uranium::platform::windows {
 
   UR_ABSTRACT_CLASS OpenGLApp : UR_EXTENDS core::IApp {
   public:
-    explicit OpenGLApp() noexcept;
+    /**
+     * @brief Opens the window of the application on the primary monitor.
+     * @param properties Configuration properties for the window.
+     */
+    explicit OpenGLApp(const core::IDisplay::Properties& properties =
+                           core::IDisplay::DEFAULT) noexcept;
+
+    /**
+     * @brief Closes the window if it is still open.
+     */
+    ~OpenGLApp() noexcept override;
 
     /**
      * @brief Provides the primary monitor.
@@ -29,6 +42,16 @@ namespace uranium::platform::windows {
      * @return const IMonitor*
      */
     const core::IMonitor* selectMonitor(uint32_t selection) override;
+
+  protected:
+    /**
+     * @brief Polls the window, the application exits once it is closed.
+     */
+    bool pollEvents() override;
+
+  protected:
+    // Created after the monitor it opens on
+    std::unique_ptr<OpenGLDisplay> display;
   };
 
 }  // namespace uranium::platform::windows
\ No newline at end of file
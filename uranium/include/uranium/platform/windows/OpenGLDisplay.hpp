@@ -29,6 +29,12 @@ namespace uranium::platform::windows {
      */
     virtual void close() override;
 
+    /**
+     * @brief Polls the GLFW events.
+     * @return False once the window was closed or asked to close.
+     */
+    virtual bool pollEvents() override;
+
     /**
      * @brief Reloads the display.
      * @param properties New properties for the display.
@@ -2,24 +2,160 @@
 
 #include "uranium/core/App.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <stdexcept>
+#include <thread>
+
+#include "uranium/core/Logger.hpp"
+#include "uranium/core/Profiler.hpp"
+#include "uranium/memory/MemoryTracker.hpp"
 
 using namespace uranium::core;
 
-IApp::IApp() noexcept {}
+IApp::IApp() noexcept
+    : monitor(),
+      loop(),
+      launch(),
+      systems(),
+      jobs(),
+      frame_memory(),
+      frame_stats(),
+      is_running(false),
+      ticks(0),
+      frames(0) {}
 
 void IApp::exit() noexcept { is_running = false; }
 
+void IApp::configure(const LaunchOptions& options) {
+  launch = options;
+  if (launch.headless) {
+    Logger::UR_INFO(LogCategory::APPLICATION,
+                    "Running headless, one tick per frame.");
+  }
+  if (launch.frames > 0) {
+    Logger::UR_INFO(LogCategory::APPLICATION, "Exiting after {} frames.",
+                    launch.frames);
+  }
+}
+
 void IApp::init() {
-  // Initialization code here
+  // Hooks may already ask to exit from onInit
+  is_running = true;
+  ticks = 0;
+  frames = 0;
+
+  Profiler::setThreadName("Main");
+
+  // Created here so the main thread is the one taking part in the jobs
+  jobs = std::make_unique<JobSystem>();
+  onInit();
 }
 
 void IApp::run() {
-  // Main loop code here
+  const Seconds tick(1.0 / loop.tick_rate);
+  const Seconds max_frame(loop.max_frame_time);
+  const Clock::duration frame_period =
+      loop.frame_rate_cap > 0.0 && !launch.headless
+          ? std::chrono::duration_cast<Clock::duration>(
+                Seconds(1.0 / loop.frame_rate_cap))
+          : Clock::duration::zero();
+
+  Clock::time_point previous = Clock::now();
+  Clock::time_point next_frame = previous;
+  Seconds accumulator(0.0);
+  Seconds update_time(0.0);
+  Seconds present_time(0.0);
+
+  while (is_running) {
+    UR_PROFILE_SCOPE("Frame");
+    if (!pollEvents()) {
+      is_running = false;
+      break;
+    }
+    Clock::time_point now = Clock::now();
+
+    // The previous frame is complete, stalls included
+    if (frames > 0) {
+      frame_stats.record(Seconds(now - previous).count(), update_time.count(),
+                         present_time.count());
+    }
+
+    // A long stall (e.g. a breakpoint) must not be simulated in full.
+    // Headless runs simulate a tick per frame whatever the frame cost
+    Seconds frame = launch.headless
+                        ? Seconds(tick)
+                        : std::min<Seconds>(now - previous, max_frame);
+    accumulator += frame;
+    previous = now;
+    frame_memory.beginFrame();
+
+    // Run the simulation at its fixed rate, independent of the render cost
+    uint32_t steps = 0;
+    Clock::time_point update_start = Clock::now();
+    while (accumulator >= tick && steps < loop.max_ticks_per_frame &&
+           is_running) {
+      UR_PROFILE_SCOPE("Update");
+      onUpdate(tick.count());
+      accumulator -= tick;
+      ++ticks;
+      ++steps;
+    }
+    update_time = Clock::now() - update_start;
+
+    // Spiral of death: the ticks cost more than they simulate, so drop
+    // the backlog instead of falling further behind every frame
+    if (accumulator >= tick) {
+      accumulator = Seconds(std::fmod(accumulator.count(), tick.count()));
+    }
+
+    {
+      UR_PROFILE_SCOPE("Systems");
+      systems.run(*jobs, frame.count());
+    }
+    {
+      UR_PROFILE_SCOPE("Render");
+      Clock::time_point present_start = Clock::now();
+      onRender(accumulator / tick);
+      present_time = Clock::now() - present_start;
+    }
+    ++frames;
+    memory::MemoryTracker::update();
+    if (launch.frames > 0 && frames >= launch.frames) {
+      is_running = false;
+    }
+
+    // Keep the frame cap on a fixed schedule, without catching up bursts
+    if (frame_period != Clock::duration::zero()) {
+      UR_PROFILE_SCOPE("Frame cap");
+      next_frame = std::max(next_frame + frame_period, Clock::now());
+      std::this_thread::sleep_until(next_frame);
+    }
+  }
+
+  // The last frame has no next one to record it
+  if (frames > 0) {
+    frame_stats.record(Seconds(Clock::now() - previous).count(),
+                       update_time.count(), present_time.count());
+  }
 }
 
 void IApp::shutdown() {
-  // Cleanup code here
+  onShutdown();
+  jobs.reset();
+
+  // Files are only written when asked for, a normal run leaves none
+  if (frame_stats.total(FrameStats::Metric::FRAME).count > 0) {
+    frame_stats.log();
+    if (!launch.bench_out.empty()) {
+      frame_stats.write(launch.bench_out);
+    }
+  }
+  if constexpr (Profiler::enabled()) {
+    if (!launch.trace_out.empty()) {
+      Profiler::write(launch.trace_out);
+    }
+  }
 }
 
 void App::borrow(std::unique_ptr<IApp> app) {
@@ -30,6 +166,15 @@ void App::borrow(std::unique_ptr<IApp> app) {
   }
 }
 
+void App::run() {
+  if (!instance) {
+    throw std::runtime_error("No App instance to run.");
+  }
+  instance->init();
+  instance->run();
+  instance->shutdown();
+}
+
 std::unique_ptr<IApp> App::release() {
   if (!instance) {
     throw std::runtime_error("No App instance to free.");
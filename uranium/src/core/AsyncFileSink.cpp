@@ -0,0 +1,143 @@
+#include "uranium/core/AsyncFileSink.hpp"
+
+#include <format>
+#include <iterator>
+#include <string>
+
+using namespace uranium::core;
+
+AsyncFileSink::AsyncFileSink() noexcept
+    : ring(),
+      pending(0),
+      backlog(false),
+      dropped(0),
+      reported_drops(0),
+      file(nullptr),
+      batch(),
+      writer(),
+      flush_requests(0),
+      flush_done(0),
+      open_flag(false),
+      stopping(false) {}
+
+AsyncFileSink::~AsyncFileSink() noexcept { this->close(); }
+
+bool AsyncFileSink::open(std::string_view path) {
+  close();
+
+  file = std::fopen(std::string(path).c_str(), "ab");
+  if (!file) {
+    return false;
+  }
+
+  // Batches are written in one call, the stdio buffer would only copy them
+  std::setvbuf(file, nullptr, _IONBF, 0);
+  batch.reserve(BATCH_SIZE);
+
+  stopping = false;
+  writer = std::thread(&AsyncFileSink::work, this);
+  open_flag.store(true, std::memory_order_release);
+  return true;
+}
+
+void AsyncFileSink::close() {
+  if (!writer.joinable()) {
+    return;
+  }
+
+  open_flag.store(false, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  wake.notify_one();
+  writer.join();
+
+  std::fclose(file);
+  file = nullptr;
+}
+
+void AsyncFileSink::flush() {
+  if (!isOpen()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  uint64_t ticket = ++flush_requests;
+  wake.notify_one();
+  flushed.wait(lock, [&] { return flush_done >= ticket || stopping; });
+}
+
+bool AsyncFileSink::isOpen() const noexcept {
+  return open_flag.load(std::memory_order_acquire);
+}
+
+uint64_t AsyncFileSink::droppedCount() const noexcept {
+  return dropped.load(std::memory_order_relaxed);
+}
+
+void AsyncFileSink::work() {
+  for (;;) {
+    uint64_t requests;
+    bool exiting;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      wake.wait_for(lock, FLUSH_INTERVAL, [&] {
+        return stopping || flush_requests != flush_done ||
+               backlog.load(std::memory_order_relaxed);
+      });
+      requests = flush_requests;
+      exiting = stopping;
+    }
+    backlog.store(false, std::memory_order_relaxed);
+
+    // Keep draining while producers fill the ring faster than one batch
+    while (drain()) {
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      flush_done = requests;
+    }
+    flushed.notify_all();
+
+    if (exiting) {
+      return;
+    }
+  }
+}
+
+bool AsyncFileSink::drain() {
+  bool full = false;
+  size_t popped = 0;
+  while (!full) {
+    if (!ring.tryConsume([&](const Record& record) {
+          batch.insert(batch.end(), record.text, record.text + record.length);
+        })) {
+      break;
+    }
+    ++popped;
+    full = batch.size() + RECORD_SIZE > BATCH_SIZE;
+  }
+  pending.fetch_sub(popped, std::memory_order_relaxed);
+
+  // Report drops after the records that made it, so the gap is visible
+  uint64_t drops = dropped.load(std::memory_order_relaxed);
+  if (drops != reported_drops && !full) {
+    std::format_to(std::back_inserter(batch),
+                   "[WARN ] {} log records dropped, the ring was full\n",
+                   drops - reported_drops);
+    reported_drops = drops;
+  }
+
+  writeBatch();
+  return full;
+}
+
+void AsyncFileSink::writeBatch() {
+  if (batch.empty()) {
+    return;
+  }
+  std::fwrite(batch.data(), 1, batch.size(), file);
+  batch.clear();
+}
@@ -0,0 +1,308 @@
+#include "uranium/core/BinaryLog.hpp"
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace uranium::core;
+
+static_assert((BinaryLog::BUFFER_SIZE & (BinaryLog::BUFFER_SIZE - 1)) == 0,
+              "BinaryLog buffers must be a power of two.");
+
+/**
+ * @struct ThreadBuffer
+ * @brief Single-producer single-consumer byte ring of one thread. Records
+ *        are framed by their u16 length and may wrap around the end.
+ */
+struct ThreadBuffer {
+  std::array<std::byte, BinaryLog::BUFFER_SIZE> data;
+  alignas(UR_CACHE_LINE) std::atomic<size_t> head{0};  // Writer thread
+  alignas(UR_CACHE_LINE) std::atomic<size_t> tail{0};  // Owner thread
+  std::atomic<uint32_t> drops{0};
+  std::atomic<bool> retired{false};
+  uint16_t thread = 0;
+};
+
+/**
+ * @struct Site
+ * @brief A registered call site.
+ */
+struct Site {
+  LogLevel level;
+  LogCategory category;
+  std::string format;
+  std::string tags;
+};
+
+/**
+ * @struct Writer
+ * @brief State shared with the background thread.
+ */
+struct Writer {
+  ~Writer() {
+    // The application did not close the log, stop the thread anyway
+    if (thread.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+      }
+      wake.notify_one();
+      thread.join();
+      std::fclose(file);
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable wake;
+  bool stopping = false;
+
+  std::vector<ThreadBuffer*> buffers;
+  std::vector<Site> sites;
+  size_t sites_written = 0;
+  uint16_t next_thread = 0;
+
+  std::FILE* file = nullptr;
+  std::thread thread;
+  std::vector<std::byte> batch;
+};
+
+static Writer& writer() {
+  static Writer instance;
+  return instance;
+}
+
+/**
+ * @struct ThreadRegistration
+ * @brief Creates the buffer of a thread on its first record, and hands it
+ *        back to the writer when the thread exits.
+ */
+struct ThreadRegistration {
+  ThreadBuffer* buffer = nullptr;
+
+  ThreadBuffer* get() {
+    if (!buffer) {
+      Writer& w = writer();
+      std::lock_guard<std::mutex> lock(w.mutex);
+      buffer = new ThreadBuffer();
+      buffer->thread = w.next_thread++;
+      w.buffers.push_back(buffer);
+    }
+    return buffer;
+  }
+
+  ~ThreadRegistration() {
+    // The writer frees the buffer once it has been drained
+    if (buffer) {
+      buffer->retired.store(true, std::memory_order_release);
+    }
+  }
+};
+
+static thread_local ThreadRegistration registration;
+
+template <typename T>
+static void append(std::vector<std::byte>& out, const T& value) {
+  const std::byte* bytes = reinterpret_cast<const std::byte*>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+static void copyOut(const ThreadBuffer& buffer, size_t from, size_t size,
+                    std::vector<std::byte>& out) {
+  constexpr size_t mask = BinaryLog::BUFFER_SIZE - 1;
+  size_t start = from & mask;
+  size_t first = std::min(size, BinaryLog::BUFFER_SIZE - start);
+  out.insert(out.end(), buffer.data.begin() + start,
+             buffer.data.begin() + start + first);
+  out.insert(out.end(), buffer.data.begin(),
+             buffer.data.begin() + (size - first));
+}
+
+static void writeSites(Writer& w) {
+  for (; w.sites_written < w.sites.size(); ++w.sites_written) {
+    const Site& site = w.sites[w.sites_written];
+    append(w.batch, urlog::SITE);
+    append(w.batch, static_cast<uint32_t>(w.sites_written));
+    append(w.batch, static_cast<uint8_t>(site.level));
+    append(w.batch, static_cast<uint8_t>(site.category));
+    append(w.batch, static_cast<uint16_t>(site.format.size()));
+    const std::byte* text =
+        reinterpret_cast<const std::byte*>(site.format.data());
+    w.batch.insert(w.batch.end(), text, text + site.format.size());
+    append(w.batch, static_cast<uint8_t>(site.tags.size()));
+    text = reinterpret_cast<const std::byte*>(site.tags.data());
+    w.batch.insert(w.batch.end(), text, text + site.tags.size());
+  }
+}
+
+static void drainBuffer(Writer& w, ThreadBuffer& buffer) {
+  size_t head = buffer.head.load(std::memory_order_relaxed);
+  size_t tail = buffer.tail.load(std::memory_order_acquire);
+
+  std::vector<std::byte> frame;
+  while (head != tail) {
+    frame.clear();
+    copyOut(buffer, head, sizeof(uint16_t), frame);
+    uint16_t length;
+    std::memcpy(&length, frame.data(), sizeof(length));
+
+    append(w.batch, urlog::RECORD);
+    append(w.batch, buffer.thread);
+    append(w.batch, length);
+    copyOut(buffer, head + sizeof(uint16_t), length, w.batch);
+    head += sizeof(uint16_t) + length;
+  }
+  buffer.head.store(head, std::memory_order_release);
+
+  uint32_t drops = buffer.drops.exchange(0, std::memory_order_relaxed);
+  if (drops != 0) {
+    append(w.batch, urlog::DROPS);
+    append(w.batch, buffer.thread);
+    append(w.batch, drops);
+  }
+}
+
+static void drainAll(Writer& w) {
+  std::vector<ThreadBuffer*> buffers;
+  {
+    std::lock_guard<std::mutex> lock(w.mutex);
+    writeSites(w);
+    buffers = w.buffers;
+  }
+
+  std::vector<ThreadBuffer*> finished;
+  for (ThreadBuffer* buffer : buffers) {
+    // Read the flag first, the last records are drained right after
+    bool retired = buffer->retired.load(std::memory_order_acquire);
+    drainBuffer(w, *buffer);
+    if (retired) {
+      finished.push_back(buffer);
+    }
+  }
+
+  if (!w.batch.empty()) {
+    std::fwrite(w.batch.data(), 1, w.batch.size(), w.file);
+    w.batch.clear();
+  }
+
+  if (!finished.empty()) {
+    std::lock_guard<std::mutex> lock(w.mutex);
+    for (ThreadBuffer* buffer : finished) {
+      std::erase(w.buffers, buffer);
+      delete buffer;
+    }
+  }
+}
+
+static void work() {
+  Writer& w = writer();
+  for (;;) {
+    bool exiting;
+    {
+      std::unique_lock<std::mutex> lock(w.mutex);
+      w.wake.wait_for(lock, BinaryLog::FLUSH_INTERVAL,
+                      [&] { return w.stopping; });
+      exiting = w.stopping;
+    }
+
+    drainAll(w);
+    if (exiting) {
+      return;
+    }
+  }
+}
+
+bool BinaryLog::open(std::string_view path) noexcept {
+  close();
+
+  Writer& w = writer();
+  w.file = std::fopen(std::string(path).c_str(), "wb");
+  if (!w.file) {
+    return false;
+  }
+  std::setvbuf(w.file, nullptr, _IONBF, 0);
+
+  // Each file carries the whole site dictionary
+  {
+    std::lock_guard<std::mutex> lock(w.mutex);
+    w.sites_written = 0;
+    w.stopping = false;
+  }
+
+  uint64_t now = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          Clock::now().time_since_epoch())
+          .count());
+  append(w.batch, urlog::MAGIC);
+  append(w.batch, urlog::VERSION);
+  append(w.batch, uint16_t(0));
+  append(w.batch, now);
+
+  w.thread = std::thread(&work);
+  opened.store(true, std::memory_order_release);
+  return true;
+}
+
+void BinaryLog::close() noexcept {
+  Writer& w = writer();
+  if (!w.thread.joinable()) {
+    return;
+  }
+
+  opened.store(false, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(w.mutex);
+    w.stopping = true;
+  }
+  w.wake.notify_one();
+  w.thread.join();
+
+  std::fclose(w.file);
+  w.file = nullptr;
+}
+
+uint32_t BinaryLog::enroll(LogLevel lvl, LogCategory cat,
+                           std::string_view fmt, std::string_view tags) {
+  Writer& w = writer();
+  std::lock_guard<std::mutex> lock(w.mutex);
+  w.sites.push_back(Site{lvl, cat, std::string(fmt), std::string(tags)});
+  return static_cast<uint32_t>(w.sites.size() - 1);
+}
+
+void BinaryLog::push(const std::byte* record, size_t size) noexcept {
+  constexpr size_t mask = BUFFER_SIZE - 1;
+  ThreadBuffer& buffer = *registration.get();
+
+  // Frame the record with its length
+  size_t needed = sizeof(uint16_t) + size;
+  size_t tail = buffer.tail.load(std::memory_order_relaxed);
+  size_t head = buffer.head.load(std::memory_order_acquire);
+  if (BUFFER_SIZE - (tail - head) < needed) {
+    drop();
+    return;
+  }
+
+  uint16_t length = static_cast<uint16_t>(size);
+  std::byte frame[sizeof(uint16_t)];
+  std::memcpy(frame, &length, sizeof(length));
+
+  auto copyIn = [&](const std::byte* bytes, size_t count) {
+    size_t start = tail & mask;
+    size_t first = std::min(count, BUFFER_SIZE - start);
+    std::memcpy(buffer.data.data() + start, bytes, first);
+    std::memcpy(buffer.data.data(), bytes + first, count - first);
+    tail += count;
+  };
+  copyIn(frame, sizeof(frame));
+  copyIn(record, size);
+
+  buffer.tail.store(tail, std::memory_order_release);
+}
+
+void BinaryLog::drop() noexcept {
+  registration.get()->drops.fetch_add(1, std::memory_order_relaxed);
+}
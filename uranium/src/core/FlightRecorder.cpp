@@ -0,0 +1,290 @@
+#include "uranium/core/FlightRecorder.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+
+#include "uranium/core/Utils.hpp"
+
+#if defined(UR_PLATFORM_WINDOWS)
+  #define WIN32_LEAN_AND_MEAN
+  #define NOMINMAX
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+using namespace uranium::core;
+
+static_assert(sizeof(FlightRecorder::FileHeader) % FlightRecorder::ALIGNMENT ==
+                  0,
+              "Records must start aligned.");
+
+FlightRecorder::FlightRecorder() noexcept
+    : mappings(), capacity(0), cursor(0), open_flag(false) {}
+
+FlightRecorder::~FlightRecorder() noexcept { this->close(); }
+
+bool FlightRecorder::open(std::string_view base, size_t file_size,
+                          uint32_t files) noexcept {
+  close();
+
+  // Records must fit in a file, and their length in a u16
+  file_size = std::clamp<size_t>(file_size, 4096, 1024 * 1024 * 1024);
+  file_size -= file_size % ALIGNMENT;
+  files = std::max<uint32_t>(files, 1);
+
+  std::string previous = std::string(base) + ".prev";
+  for (uint32_t slot = 0; slot < files; ++slot) {
+    std::error_code error;
+    std::filesystem::rename(pathOf(base, slot), pathOf(previous, slot),
+                            error);
+  }
+
+  for (uint32_t slot = 0; slot < files; ++slot) {
+    Mapping mapping;
+    if (!map(pathOf(base, slot), file_size, mapping)) {
+      close();
+      return false;
+    }
+
+    FileHeader* header = reinterpret_cast<FileHeader*>(mapping.data);
+    header->magic = MAGIC;
+    header->version = VERSION;
+    header->reserved = 0;
+    header->generation = EMPTY;
+    mappings.push_back(mapping);
+  }
+
+  capacity = file_size - sizeof(FileHeader);
+  cursor.store(0, std::memory_order_relaxed);
+  open_flag.store(true, std::memory_order_release);
+  return true;
+}
+
+void FlightRecorder::close() noexcept {
+  open_flag.store(false, std::memory_order_release);
+  for (Mapping& mapping : mappings) {
+    unmap(mapping);
+  }
+  mappings.clear();
+}
+
+void FlightRecorder::record(LogLevel lvl, LogCategory cat,
+                            std::string_view msg) noexcept {
+  constexpr uint64_t header_size = sizeof(RecordHeader);
+  msg = msg.substr(0, std::min<uint64_t>(capacity - header_size, 0xFFFF));
+
+  uint64_t size = header_size + msg.size();
+  size = (size + ALIGNMENT - 1) & ~uint64_t(ALIGNMENT - 1);
+
+  uint64_t time = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count());
+
+  for (;;) {
+    uint64_t position = cursor.fetch_add(size, std::memory_order_relaxed);
+    uint64_t generation = position / capacity;
+    uint64_t offset = position % capacity;
+
+    // The reservation straddles two files, pad both halves and try again
+    if (offset + size > capacity) {
+      pad(generation, offset, capacity - offset);
+      begin(generation + 1);
+      pad(generation + 1, 0, offset + size - capacity);
+      continue;
+    }
+
+    if (offset == 0) {
+      begin(generation);
+    }
+
+    RecordHeader* header = at(generation, offset);
+    header->size = static_cast<uint32_t>(size);
+    header->time = time;
+    header->level = static_cast<uint8_t>(lvl);
+    header->category = static_cast<uint8_t>(cat);
+    header->length = static_cast<uint16_t>(msg.size());
+    std::memcpy(header + 1, msg.data(), msg.size());
+
+    std::atomic_ref<uint32_t>(header->commit)
+        .store(stampOf(generation), std::memory_order_release);
+    return;
+  }
+}
+
+bool FlightRecorder::isOpen() const noexcept {
+  return open_flag.load(std::memory_order_acquire);
+}
+
+std::string FlightRecorder::pathOf(std::string_view base, uint32_t slot) {
+  return std::format("{}-{}.urfr", base, slot);
+}
+
+void FlightRecorder::begin(uint64_t generation) noexcept {
+  FileHeader* header = reinterpret_cast<FileHeader*>(
+      mappings[generation % mappings.size()].data);
+  std::atomic_ref<uint64_t>(header->generation)
+      .store(generation, std::memory_order_release);
+}
+
+void FlightRecorder::pad(uint64_t generation, uint64_t offset,
+                         uint64_t size) noexcept {
+  // Only the size and the stamp, which fit in the smallest padding
+  RecordHeader* header = at(generation, offset);
+  header->size = static_cast<uint32_t>(size);
+  std::atomic_ref<uint32_t>(header->commit)
+      .store(stampOf(generation) | PADDING, std::memory_order_release);
+}
+
+FlightRecorder::RecordHeader* FlightRecorder::at(uint64_t generation,
+                                                 uint64_t offset) noexcept {
+  std::byte* data = mappings[generation % mappings.size()].data;
+  return reinterpret_cast<RecordHeader*>(data + sizeof(FileHeader) + offset);
+}
+
+uint32_t FlightRecorder::stampOf(uint64_t generation) noexcept {
+  // Never zero, so a record that was reserved but not written is skipped
+  return static_cast<uint32_t>((generation + 1) & ~uint64_t(PADDING));
+}
+
+size_t FlightRecorder::dump(std::string_view base, std::FILE* out) {
+  struct File {
+    uint64_t generation;
+    std::string data;
+  };
+
+  std::vector<File> files;
+  for (uint32_t slot = 0;; ++slot) {
+    std::ifstream stream(pathOf(base, slot), std::ios::binary);
+    if (!stream.is_open()) {
+      break;
+    }
+
+    File file;
+    file.data.assign(std::istreambuf_iterator<char>(stream),
+                     std::istreambuf_iterator<char>());
+    FileHeader header;
+    if (file.data.size() < sizeof(header)) {
+      continue;
+    }
+    std::memcpy(&header, file.data.data(), sizeof(header));
+    if (header.magic != MAGIC || header.version != VERSION ||
+        header.generation == EMPTY) {
+      continue;
+    }
+    file.generation = header.generation;
+    files.push_back(std::move(file));
+  }
+
+  std::sort(files.begin(), files.end(), [](const File& a, const File& b) {
+    return a.generation < b.generation;
+  });
+
+  size_t records = 0;
+  for (const File& file : files) {
+    uint32_t stamp = stampOf(file.generation);
+    size_t offset = sizeof(FileHeader);
+    while (offset + sizeof(uint64_t) <= file.data.size()) {
+      RecordHeader header{};
+      std::memcpy(&header, file.data.data() + offset,
+                  std::min(sizeof(header), file.data.size() - offset));
+
+      // Past the last record, or into the records of an older generation
+      if (header.size < sizeof(uint64_t) || header.size % ALIGNMENT != 0 ||
+          header.size > file.data.size() - offset) {
+        break;
+      }
+
+      if (header.commit == stamp && header.size >= sizeof(header) &&
+          header.length <= header.size - sizeof(header)) {
+        std::chrono::sys_time<std::chrono::nanoseconds> time{
+            std::chrono::nanoseconds(header.time)};
+        std::string_view text(file.data.data() + offset + sizeof(header),
+                              header.length);
+        std::string line = std::format(
+            "{:%F %T} [{:<5}] {} {}\n",
+            std::chrono::floor<std::chrono::microseconds>(time),
+            Logger::toString(static_cast<LogLevel>(header.level)),
+            Logger::toString(static_cast<LogCategory>(header.category)),
+            text);
+        std::fwrite(line.data(), 1, line.size(), out);
+        ++records;
+      }
+      offset += header.size;
+    }
+  }
+  return records;
+}
+
+#if defined(UR_PLATFORM_WINDOWS)
+bool FlightRecorder::map(const std::string& path, size_t size,
+                         Mapping& mapping) {
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                            FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+
+  ULARGE_INTEGER bytes;
+  bytes.QuadPart = size;
+  HANDLE section = CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+                                      bytes.HighPart, bytes.LowPart, nullptr);
+  CloseHandle(file);
+  if (!section) {
+    return false;
+  }
+
+  // The view keeps the section alive
+  void* data = MapViewOfFile(section, FILE_MAP_WRITE, 0, 0, size);
+  CloseHandle(section);
+  if (!data) {
+    return false;
+  }
+
+  mapping.data = static_cast<std::byte*>(data);
+  mapping.size = size;
+  return true;
+}
+
+void FlightRecorder::unmap(Mapping& mapping) noexcept {
+  UnmapViewOfFile(mapping.data);
+}
+#else
+bool FlightRecorder::map(const std::string& path, size_t size,
+                         Mapping& mapping) {
+  int file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (file < 0) {
+    return false;
+  }
+
+  if (::ftruncate(file, static_cast<off_t>(size)) != 0) {
+    ::close(file);
+    return false;
+  }
+
+  // The mapping keeps the file alive
+  void* data =
+      ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+  ::close(file);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+
+  mapping.data = static_cast<std::byte*>(data);
+  mapping.size = size;
+  return true;
+}
+
+void FlightRecorder::unmap(Mapping& mapping) noexcept {
+  ::munmap(mapping.data, mapping.size);
+}
+#endif
@@ -0,0 +1,148 @@
+#include "uranium/core/FrameStats.hpp"
+
+#include <cstdio>
+#include <format>
+#include <string>
+
+#include "uranium/core/Logger.hpp"
+
+using namespace uranium::core;
+
+static constexpr std::array<std::string_view, 3> METRIC_NAMES = {
+    "frame", "update", "present"};
+
+static uint64_t toMicroseconds(double seconds) noexcept {
+  return seconds > 0.0 ? static_cast<uint64_t>(seconds * 1e6 + 0.5) : 0;
+}
+
+FrameStats::FrameStats() noexcept : FrameStats(Settings()) {}
+
+FrameStats::FrameStats(const Settings& settings) noexcept
+    : settings(settings),
+      hitch_limit(toMicroseconds(settings.hitch_time)),
+      all(),
+      current(),
+      last(),
+      window_elapsed(0.0),
+      all_hitches(),
+      current_hitches(),
+      last_hitches() {}
+
+void FrameStats::record(double frame, double update,
+                        double present) noexcept {
+  const std::array<uint64_t, METRICS> values = {
+      toMicroseconds(frame), toMicroseconds(update), toMicroseconds(present)};
+  for (size_t i = 0; i < METRICS; ++i) {
+    all[i].record(values[i]);
+    current[i].record(values[i]);
+    if (values[i] > hitch_limit) {
+      ++all_hitches[i];
+      ++current_hitches[i];
+    }
+  }
+
+  // Windows are measured in frame time, so a stall cannot skip one
+  window_elapsed += frame;
+  if (window_elapsed >= settings.window) {
+    last = current;
+    last_hitches = current_hitches;
+    for (Histogram& histogram : current) {
+      histogram.reset();
+    }
+    current_hitches.fill(0);
+    window_elapsed = 0.0;
+  }
+}
+
+FrameStats::Summary FrameStats::window(Metric metric) const noexcept {
+  size_t i = static_cast<size_t>(metric);
+  return summarize(last[i], last_hitches[i]);
+}
+
+FrameStats::Summary FrameStats::total(Metric metric) const noexcept {
+  size_t i = static_cast<size_t>(metric);
+  return summarize(all[i], all_hitches[i]);
+}
+
+void FrameStats::reset() noexcept {
+  for (size_t i = 0; i < METRICS; ++i) {
+    all[i].reset();
+    current[i].reset();
+    last[i].reset();
+  }
+  all_hitches.fill(0);
+  current_hitches.fill(0);
+  last_hitches.fill(0);
+  window_elapsed = 0.0;
+}
+
+void FrameStats::log() const {
+  for (size_t i = 0; i < METRICS; ++i) {
+    Summary summary = summarize(all[i], all_hitches[i]);
+    Logger::UR_INFO(LogCategory::ENGINE,
+                    "{} over {} frames: p50 {:.3f} ms, p95 {:.3f} ms, "
+                    "p99 {:.3f} ms, max {:.3f} ms, {} hitches",
+                    METRIC_NAMES[i], summary.count, summary.p50, summary.p95,
+                    summary.p99, summary.max, summary.hitches);
+  }
+}
+
+static void appendSummary(std::string& out, const FrameStats::Summary& s) {
+  out += std::format(
+      "{{\"count\": {}, \"mean\": {:.3f}, \"p50\": {:.3f}, \"p95\": {:.3f}, "
+      "\"p99\": {:.3f}, \"max\": {:.3f}, \"hitches\": {}}}",
+      s.count, s.mean, s.p50, s.p95, s.p99, s.max, s.hitches);
+}
+
+bool FrameStats::write(std::string_view path) const {
+  std::string out = std::format(
+      "{{\n  \"unit\": \"ms\",\n  \"window\": {:.3f},\n"
+      "  \"hitch_time\": {:.3f},\n  \"metrics\": {{",
+      settings.window * 1e3, settings.hitch_time * 1e3);
+
+  for (size_t i = 0; i < METRICS; ++i) {
+    out += std::format("{}\n    \"{}\": {{\n      \"total\": ",
+                       i ? "," : "", METRIC_NAMES[i]);
+    appendSummary(out, summarize(all[i], all_hitches[i]));
+    out += ",\n      \"last_window\": ";
+    appendSummary(out, summarize(last[i], last_hitches[i]));
+
+    // Non-empty buckets as [highest value in ms, count]
+    out += ",\n      \"histogram\": [";
+    bool first = true;
+    for (size_t bucket = 0; bucket < Histogram::BUCKETS; ++bucket) {
+      if (uint64_t count = all[i].bucketCount(bucket)) {
+        out += std::format("{}[{:.3f}, {}]", first ? "" : ", ",
+                           Histogram::bucketLimit(bucket) / 1e3, count);
+        first = false;
+      }
+    }
+    out += "]\n    }";
+  }
+  out += "\n  }\n}\n";
+
+  std::FILE* file = std::fopen(std::string(path).c_str(), "wb");
+  bool written = file && std::fwrite(out.data(), 1, out.size(), file) ==
+                             out.size();
+  if (file) {
+    written = std::fclose(file) == 0 && written;
+  }
+  if (!written) {
+    Logger::UR_ERROR(LogCategory::ENGINE,
+                     "Cannot write the frame statistics to {}.", path);
+  }
+  return written;
+}
+
+FrameStats::Summary FrameStats::summarize(const Histogram& histogram,
+                                          uint64_t hitches) const noexcept {
+  Summary summary;
+  summary.count = histogram.count();
+  summary.mean = histogram.mean() / 1e3;
+  summary.p50 = histogram.percentile(0.50) / 1e3;
+  summary.p95 = histogram.percentile(0.95) / 1e3;
+  summary.p99 = histogram.percentile(0.99) / 1e3;
+  summary.max = histogram.max() / 1e3;
+  summary.hitches = hitches;
+  return summary;
+}
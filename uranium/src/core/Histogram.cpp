@@ -0,0 +1,97 @@
+#include "uranium/core/Histogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+using namespace uranium::core;
+
+Histogram::Histogram() noexcept : counts(), total(0), largest(0), sum(0) {}
+
+void Histogram::record(uint64_t value) noexcept {
+  ++counts[indexOf(value)];
+  ++total;
+  largest = std::max(largest, value);
+  sum += value;
+}
+
+void Histogram::merge(const Histogram& other) noexcept {
+  for (size_t i = 0; i < BUCKETS; ++i) {
+    counts[i] += other.counts[i];
+  }
+  total += other.total;
+  largest = std::max(largest, other.largest);
+  sum += other.sum;
+}
+
+void Histogram::reset() noexcept {
+  counts.fill(0);
+  total = 0;
+  largest = 0;
+  sum = 0;
+}
+
+uint64_t Histogram::percentile(double fraction) const noexcept {
+  if (total == 0) {
+    return 0;
+  }
+  uint64_t target = std::max<uint64_t>(
+      1, static_cast<uint64_t>(std::ceil(std::clamp(fraction, 0.0, 1.0) *
+                                         static_cast<double>(total))));
+
+  uint64_t seen = 0;
+  for (size_t i = 0; i < BUCKETS; ++i) {
+    seen += counts[i];
+    if (seen >= target) {
+      return std::min(bucketLimit(i), largest);
+    }
+  }
+  return largest;
+}
+
+double Histogram::mean() const noexcept {
+  return total ? static_cast<double>(sum) / static_cast<double>(total) : 0.0;
+}
+
+uint64_t Histogram::countAbove(uint64_t threshold) const noexcept {
+  // Start at the first bucket holding any value over the threshold
+  size_t first = indexOf(threshold);
+  if (bucketLimit(first) <= threshold) {
+    ++first;
+  }
+
+  uint64_t above = 0;
+  for (size_t i = first; i < BUCKETS; ++i) {
+    above += counts[i];
+  }
+  return above;
+}
+
+uint64_t Histogram::bucketCount(size_t bucket) const noexcept {
+  return counts[bucket];
+}
+
+uint64_t Histogram::bucketLimit(size_t bucket) noexcept {
+  // The first two ranges hold one value per bucket
+  if (bucket < 2 * SUB_BUCKETS) {
+    return bucket;
+  }
+  uint32_t shift = static_cast<uint32_t>(bucket / SUB_BUCKETS) - 1;
+  uint64_t sub = bucket % SUB_BUCKETS + SUB_BUCKETS;
+  return ((sub + 1) << shift) - 1;
+}
+
+size_t Histogram::indexOf(uint64_t value) noexcept {
+  if (value < 2 * SUB_BUCKETS) {
+    return static_cast<size_t>(value);
+  }
+  if (value >> MAX_EXPONENT) {
+    return BUCKETS - 1;
+  }
+
+  // Keep the SUB_BUCKET_BITS bits under the leading one
+  uint32_t shift =
+      static_cast<uint32_t>(std::bit_width(value)) - SUB_BUCKET_BITS - 1;
+  return (shift + 1) * SUB_BUCKETS +
+         static_cast<size_t>((value >> shift) - SUB_BUCKETS);
+}
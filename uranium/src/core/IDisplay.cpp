@@ -22,6 +22,9 @@ IDisplay::IDisplay(const Properties& properties,
                    const IMonitor& smonitor) noexcept
     : properties(properties), initialized(false) {}
 
+IDisplay::IDisplay(const Properties& properties) noexcept
+    : properties(properties), initialized(false) {}
+
 uint32_t IDisplay::getWidth() const {
   // Width
   return properties.width;
@@ -0,0 +1,330 @@
+#include "uranium/core/JobSystem.hpp"
+
+#include <algorithm>
+#include <format>
+
+#include "uranium/core/Profiler.hpp"
+
+using namespace uranium::core;
+
+/**
+ * @struct ThreadSlot
+ * @brief The system a worker thread belongs to, and its worker index. The
+ *        creating thread is not registered here, it may create several
+ *        systems.
+ */
+struct ThreadSlot {
+  const JobSystem* system = nullptr;
+  uint32_t index = 0;
+};
+
+static thread_local ThreadSlot thread_slot;
+
+// Rounds a thread looks for work before going to sleep
+static constexpr uint32_t SPIN_ROUNDS = 64;
+
+JobSystem::JobSystem(uint32_t workers)
+    : workers(),
+      threads(),
+      creator(std::this_thread::get_id()),
+      epoch(0),
+      sleeping(0),
+      stopping(false) {
+  for (uint32_t i = 0; i <= workers; ++i) {
+    auto worker = std::make_unique<Worker>();
+    worker->seed = 0x9E3779B9u * (i + 1);
+
+    // Every job starts on the free list of its owner
+    for (size_t j = MAX_JOBS; j-- > 0;) {
+      worker->jobs[j].owner = i;
+      worker->jobs[j].next_free = worker->free_jobs;
+      worker->free_jobs = &worker->jobs[j];
+    }
+    this->workers.push_back(std::move(worker));
+  }
+
+  threads.reserve(workers);
+  for (uint32_t i = 1; i <= workers; ++i) {
+    threads.emplace_back(&JobSystem::work, this, i);
+  }
+}
+
+JobSystem::~JobSystem() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping.store(true, std::memory_order_relaxed);
+    epoch.fetch_add(1, std::memory_order_relaxed);
+  }
+  wake.notify_all();
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+void JobSystem::run(const Task& task, JobCounter* counter,
+                    JobCounter* after) {
+  if (counter) {
+    counter->pending.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Threads outside the system have no deque to push into
+  uint32_t index = slot();
+  if (index == NO_SLOT) {
+    if (after) {
+      wait(*after);
+    }
+    task();
+    if (counter) {
+      finish(*counter);
+    }
+    return;
+  }
+
+  // Every job of this thread is still in flight, help until one of them is
+  // released. When none can be found to help with, they are running on
+  // other threads or parked, and this one runs inline instead
+  Worker& worker = *workers[index];
+  Job* job;
+  while (!(job = allocate(worker))) {
+    if (Job* pending = find(index)) {
+      execute(pending);
+      continue;
+    }
+    if (after) {
+      wait(*after);
+    }
+    task();
+    if (counter) {
+      finish(*counter);
+    }
+    return;
+  }
+  job->task = task;
+  job->counter = counter;
+
+  // Park the job on its dependency, unless its last job already finished.
+  // Checked under the lock, so finish() cannot miss it
+  if (after && !after->done()) {
+    std::lock_guard<std::mutex> lock(after->mutex);
+    if (after->pending.load(std::memory_order_acquire) != 0) {
+      after->dependents.push_back(job);
+      return;
+    }
+  }
+  schedule(job);
+}
+
+void JobSystem::wait(const JobCounter& counter) {
+  uint32_t index = slot();
+  if (index == NO_SLOT) {
+    while (!counter.done()) {
+      std::this_thread::yield();
+    }
+    return;
+  }
+
+  // Help instead of blocking, the jobs waited on may be in any deque
+  while (!counter.done()) {
+    if (Job* job = find(index)) {
+      execute(job);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void JobSystem::parallelFor(size_t count, const RangeTask& task,
+                            size_t grain) {
+  if (count == 0) {
+    return;
+  }
+  if (grain == 0) {
+    size_t chunks = workers.size() * CHUNKS_PER_THREAD;
+    grain = std::max<size_t>(1, (count + chunks - 1) / chunks);
+  }
+
+  // A single chunk is not worth a job
+  if (grain >= count) {
+    task(0, count);
+    return;
+  }
+
+  JobCounter counter;
+  for (size_t begin = grain; begin < count; begin += grain) {
+    size_t end = std::min(count, begin + grain);
+    run([&task, begin, end] { task(begin, end); }, &counter);
+  }
+
+  // The caller takes the first chunk, then helps with the rest
+  task(0, grain);
+  wait(counter);
+}
+
+uint32_t JobSystem::size() const noexcept {
+  return static_cast<uint32_t>(threads.size());
+}
+
+uint32_t JobSystem::defaultWorkers() noexcept {
+  uint32_t hardware = std::thread::hardware_concurrency();
+  return hardware > 1 ? hardware - 1 : 0;
+}
+
+void JobSystem::work(uint32_t index) {
+  thread_slot = ThreadSlot{this, index};
+  Profiler::setThreadName(std::format("Worker {}", index));
+
+  uint32_t idle = 0;
+  while (!stopping.load(std::memory_order_relaxed)) {
+    if (Job* job = find(index)) {
+      execute(job);
+      idle = 0;
+    } else if (++idle < SPIN_ROUNDS) {
+      std::this_thread::yield();
+    } else {
+      sleep();
+      idle = 0;
+    }
+  }
+}
+
+Job* JobSystem::allocate(Worker& worker) noexcept {
+  // Take back everything other threads released at once
+  if (!worker.free_jobs) {
+    worker.free_jobs =
+        worker.returned.exchange(nullptr, std::memory_order_acquire);
+    if (!worker.free_jobs) {
+      return nullptr;
+    }
+  }
+  Job* job = worker.free_jobs;
+  worker.free_jobs = job->next_free;
+  return job;
+}
+
+void JobSystem::release(Job* job) noexcept {
+  job->task = nullptr;
+  job->counter = nullptr;
+
+  Worker& owner = *workers[job->owner];
+  if (slot() == job->owner) {
+    job->next_free = owner.free_jobs;
+    owner.free_jobs = job;
+    return;
+  }
+
+  // Only the owner takes from the list, and it takes all of it, so pushing
+  // does not suffer from ABA
+  Job* head = owner.returned.load(std::memory_order_relaxed);
+  do {
+    job->next_free = head;
+  } while (!owner.returned.compare_exchange_weak(
+      head, job, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void JobSystem::schedule(Job* job) {
+  if (!current().deque.push(job)) {
+    execute(job);  // Deque full, run it right away
+    return;
+  }
+
+  // Pairs with the sleeper registering before its last look at the deques
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (sleeping.load(std::memory_order_relaxed) > 0) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      epoch.fetch_add(1, std::memory_order_relaxed);
+    }
+    wake.notify_one();
+  }
+}
+
+void JobSystem::execute(Job* job) {
+  JobCounter* counter = job->counter;
+  job->task();
+  release(job);
+  if (counter) {
+    finish(*counter);
+  }
+}
+
+void JobSystem::finish(JobCounter& counter) {
+  counter.finishing.fetch_add(1, std::memory_order_relaxed);
+
+  // Last job of the counter, release the jobs depending on it
+  std::vector<Job*> ready;
+  if (counter.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    std::lock_guard<std::mutex> lock(counter.mutex);
+    ready.swap(counter.dependents);
+  }
+
+  // The counter may be gone after this
+  counter.finishing.fetch_sub(1, std::memory_order_release);
+
+  bool member = slot() != NO_SLOT;
+  for (Job* job : ready) {
+    if (member) {
+      schedule(job);
+    } else {
+      execute(job);
+    }
+  }
+}
+
+void JobSystem::sleep() {
+  uint64_t seen = epoch.load(std::memory_order_relaxed);
+  sleeping.fetch_add(1, std::memory_order_seq_cst);
+
+  // Last look, a job pushed before the increment was not announced
+  bool found = false;
+  for (const auto& worker : workers) {
+    if (!worker->deque.empty()) {
+      found = true;
+      break;
+    }
+  }
+
+  if (!found) {
+    std::unique_lock<std::mutex> lock(mutex);
+    wake.wait(lock, [&] {
+      return epoch.load(std::memory_order_relaxed) != seen ||
+             stopping.load(std::memory_order_relaxed);
+    });
+  }
+  sleeping.fetch_sub(1, std::memory_order_relaxed);
+}
+
+Job* JobSystem::find(uint32_t index) noexcept {
+  Worker& self = *workers[index];
+  if (Job* job = self.deque.pop()) {
+    return job;
+  }
+
+  // Start from a random victim so thieves spread over the deques
+  uint32_t count = static_cast<uint32_t>(workers.size());
+  self.seed ^= self.seed << 13;
+  self.seed ^= self.seed >> 17;
+  self.seed ^= self.seed << 5;
+  uint32_t start = self.seed % count;
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t victim = (start + i) % count;
+    if (victim == index) {
+      continue;
+    }
+    if (Job* job = workers[victim]->deque.steal()) {
+      return job;
+    }
+  }
+  return nullptr;
+}
+
+uint32_t JobSystem::slot() const noexcept {
+  if (thread_slot.system == this) {
+    return thread_slot.index;
+  }
+  return std::this_thread::get_id() == creator ? 0 : NO_SLOT;
+}
+
+JobSystem::Worker& JobSystem::current() {
+  return *workers[slot()];
+}
@@ -0,0 +1,60 @@
+#include "uranium/core/LaunchOptions.hpp"
+
+#include <charconv>
+
+#include "uranium/core/Logger.hpp"
+
+using namespace uranium::core;
+
+LaunchOptions LaunchOptions::parse(const std::vector<std::string>& args) {
+  LaunchOptions options;
+
+  for (size_t i = 1; i < args.size(); ++i) {
+    const std::string& arg = args[i];
+    bool has_value = i + 1 < args.size();
+
+    if (arg == "--headless") {
+      options.headless = true;
+    } else if (arg == "--frames") {
+      if (!has_value) {
+        Logger::UR_WARN(LogCategory::APPLICATION,
+                        "--frames expects a number of frames.");
+        continue;
+      }
+      const std::string& value = args[++i];
+      uint64_t frames = 0;
+      auto [end, error] =
+          std::from_chars(value.data(), value.data() + value.size(), frames);
+      if (error != std::errc() || end != value.data() + value.size()) {
+        Logger::UR_WARN(LogCategory::APPLICATION,
+                        "Ignoring --frames {}, not a number of frames.",
+                        value);
+        continue;
+      }
+      options.frames = frames;
+    } else if (arg == "--bench-out") {
+      if (!has_value) {
+        Logger::UR_WARN(LogCategory::APPLICATION,
+                        "--bench-out expects a file.");
+        continue;
+      }
+      options.bench_out = args[++i];
+    } else if (arg == "--trace-out") {
+      if (!has_value) {
+        Logger::UR_WARN(LogCategory::APPLICATION,
+                        "--trace-out expects a file.");
+        continue;
+      }
+      options.trace_out = args[++i];
+    }
+  }
+
+  // Nobody can close a headless run, e.g. a CI job, so it must end itself
+  if (options.headless && options.frames == 0) {
+    Logger::UR_WARN(LogCategory::APPLICATION,
+                    "--headless without --frames, running {} frames.",
+                    HEADLESS_FRAMES);
+    options.frames = HEADLESS_FRAMES;
+  }
+  return options;
+}
@@ -1,11 +1,15 @@
 #include "uranium/core/Logger.hpp"
 
 #include <cstdint>
+#include <mutex>
 #include <print>
 
+#include "uranium/core/AsyncFileSink.hpp"
+#include "uranium/core/FlightRecorder.hpp"
+
 using namespace uranium::core;
 
-static enum class TextColor {
+enum class TextColor {
   BLACK = 0,
   RED,
   GREEN,
@@ -19,6 +23,12 @@ static enum class TextColor {
 
 #define TO_INT(x) static_cast<uint32_t>(x)
 
+// Written by a background thread, see Logger::fout
+static AsyncFileSink file_sink;
+
+// Last records before a crash, see Logger::openFlightRecorder
+static FlightRecorder flight_recorder;
+
 static std::string_view color_codes[TO_INT(TextColor::COUNT)] = {
     "\033[0;30m",  // BLACK
     "\033[0;31m",  // RED
@@ -30,7 +40,7 @@ static std::string_view color_codes[TO_INT(TextColor::COUNT)] = {
     "\033[0;37m"   // WHITE
 };
 
-inline std::string_view Logger::toString(LogLevel level) noexcept {
+std::string_view Logger::toString(LogLevel level) noexcept {
   switch (level) {
     case LogLevel::INFO:
       return "INFO";
@@ -49,7 +59,7 @@ inline std::string_view Logger::toString(LogLevel level) noexcept {
   }
 }
 
-inline std::string_view Logger::toString(LogCategory category) noexcept {
+std::string_view Logger::toString(LogCategory category) noexcept {
   switch (category) {
     case LogCategory::SYSTEM:
       return "[SYSTEM]";
@@ -127,4 +137,76 @@ void Logger::cout(LogLevel lvl, LogCategory cat,
 }
 
 void Logger::fout(LogLevel lvl, LogCategory cat,
-                  std::string_view msg) noexcept {}
+                  std::string_view msg) noexcept {
+  // Open the default file once, unless the application opened its own
+  static std::once_flag opened;
+  std::call_once(opened, [] {
+    if (!file_sink.isOpen()) {
+      file_sink.open(DEFAULT_FILE);
+    }
+  });
+
+  // Format straight into the ring, the writer thread does the I/O
+  file_sink.push([&](char* out, size_t size) {
+    auto result = std::format_to_n(out, size, "[{:<5}] {} {}\n",
+                                   toString(lvl), toString(cat), msg);
+    return static_cast<size_t>(result.size);
+  });
+
+  // The process is about to go down, make sure the reason reaches the disk
+  if (lvl == LogLevel::FATAL) {
+    file_sink.flush();
+  }
+}
+
+void Logger::setThreshold(LogCategory cat, LogLevel lvl) noexcept {
+  uint64_t keep = 0;
+  uint64_t clear = 0;
+  for (uint32_t level = 0; level < TO_INT(LogLevel::COUNT); ++level) {
+    uint64_t bit = bitOf(LogLevel(level), cat);
+    if (severityOf(LogLevel(level)) >= severityOf(lvl)) {
+      keep |= bit;
+    } else {
+      clear |= bit;
+    }
+  }
+
+  // Other threads may be changing other categories at the same time
+  uint64_t mask = levels.load(std::memory_order_relaxed);
+  while (!levels.compare_exchange_weak(mask, (mask & ~clear) | keep,
+                                       std::memory_order_relaxed)) {
+  }
+}
+
+void Logger::setThreshold(LogLevel lvl) noexcept {
+  levels.store(maskOf(lvl), std::memory_order_relaxed);
+}
+
+void Logger::write(LogLevel lvl, LogCategory cat,
+                   std::string_view msg) noexcept {
+  if (flight_recorder.isOpen()) {
+    flight_recorder.record(lvl, cat, msg);
+  }
+
+#if defined(UR_DEBUG)
+  cout(lvl, cat, msg);
+#else
+  fout(lvl, cat, msg);
+#endif
+}
+
+bool Logger::open(std::string_view path) noexcept {
+  return file_sink.open(path);
+}
+
+void Logger::close() noexcept { file_sink.close(); }
+
+bool Logger::openFlightRecorder(std::string_view base) noexcept {
+  return flight_recorder.open(base);
+}
+
+void Logger::closeFlightRecorder() noexcept { flight_recorder.close(); }
+
+void Logger::flush() noexcept { file_sink.flush(); }
+
+uint64_t Logger::droppedCount() noexcept { return file_sink.droppedCount(); }
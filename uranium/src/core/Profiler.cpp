@@ -0,0 +1,213 @@
+#include "uranium/core/Profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <format>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "uranium/core/Logger.hpp"
+
+using namespace uranium::core;
+
+static_assert((Profiler::ZONES_PER_THREAD &
+               (Profiler::ZONES_PER_THREAD - 1)) == 0,
+              "Profiler rings must be a power of two.");
+
+/**
+ * @struct Zone
+ * @brief A recorded zone. Atomic only so write() may read it while the
+ *        owner overwrites it, every access is relaxed.
+ */
+struct Zone {
+  std::atomic<const char*> name;
+  std::atomic<int64_t> begin;
+  std::atomic<int64_t> end;
+};
+
+/**
+ * @struct ThreadBuffer
+ * @brief Ring of zones of one thread. The owner announces a slot in
+ *        reserved before overwriting it and in committed once written, so
+ *        a reader can tell which of the slots it copied were overwritten.
+ */
+struct ThreadBuffer {
+  std::array<Zone, Profiler::ZONES_PER_THREAD> zones;
+  alignas(UR_CACHE_LINE) std::atomic<uint64_t> reserved{0};
+  std::atomic<uint64_t> committed{0};
+  uint32_t thread = 0;
+  std::string name;  // Guarded by the registry mutex
+};
+
+/**
+ * @struct Registry
+ * @brief Every buffer ever created. Buffers outlive their threads so the
+ *        zones of finished threads are still written, and are never freed
+ *        as threads may record until the process ends.
+ */
+struct Registry {
+  std::mutex mutex;
+  std::vector<ThreadBuffer*> buffers;
+};
+
+static Registry& registry() {
+  static Registry* instance = new Registry();
+  return *instance;
+}
+
+/**
+ * @struct ThreadRegistration
+ * @brief Creates the buffer of a thread on its first zone, with the name
+ *        given to the thread so far.
+ */
+struct ThreadRegistration {
+  ThreadBuffer* buffer = nullptr;
+  std::string name;
+
+  ThreadBuffer* get() {
+    if (!buffer) {
+      Registry& r = registry();
+      ThreadBuffer* created = new ThreadBuffer();
+      std::lock_guard<std::mutex> lock(r.mutex);
+      created->thread = static_cast<uint32_t>(r.buffers.size()) + 1;
+      created->name = name.empty()
+                          ? std::format("Thread {}", created->thread)
+                          : name;
+      r.buffers.push_back(created);
+      buffer = created;
+    }
+    return buffer;
+  }
+};
+
+static thread_local ThreadRegistration registration;
+
+// Zones are written relative to the start of the process
+static const int64_t epoch = Profiler::now();
+
+void Profiler::record(const char* name, int64_t begin, int64_t end) noexcept {
+  ThreadBuffer* buffer = registration.get();
+  uint64_t index = buffer->committed.load(std::memory_order_relaxed);
+  Zone& zone = buffer->zones[index & (ZONES_PER_THREAD - 1)];
+
+  buffer->reserved.store(index + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  zone.name.store(name, std::memory_order_relaxed);
+  zone.begin.store(begin, std::memory_order_relaxed);
+  zone.end.store(end, std::memory_order_relaxed);
+  buffer->committed.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::setThreadName(std::string_view name) {
+  registration.name = name;
+  if (registration.buffer) {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    registration.buffer->name = name;
+  } else if constexpr (enabled()) {
+    // Allocate here, where a failure can throw, and not in record()
+    registration.get();
+  }
+}
+
+int64_t Profiler::now() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Names are usually identifiers, but may come from anywhere
+static void appendEscaped(std::string& out, std::string_view text) {
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      out += std::format("\\u{:04x}", c);
+    } else {
+      out += c;
+    }
+  }
+}
+
+bool Profiler::write(std::string_view path) {
+  std::FILE* file = std::fopen(std::string(path).c_str(), "wb");
+  if (!file) {
+    Logger::UR_ERROR(LogCategory::ENGINE, "Cannot write the trace to {}.",
+                     path);
+    return false;
+  }
+
+  // Snapshot the buffer list, the buffers themselves are never freed
+  std::vector<std::pair<ThreadBuffer*, std::string>> buffers;
+  {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    for (ThreadBuffer* buffer : registry().buffers) {
+      buffers.emplace_back(buffer, buffer->name);
+    }
+  }
+
+  std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+         "\"args\":{\"name\":\"uranium\"}}";
+  size_t zones = 0;
+
+  for (const auto& [buffer, name] : buffers) {
+    out += std::format(
+        ",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+        "\"args\":{{\"name\":\"",
+        buffer->thread);
+    appendEscaped(out, name);
+    out += "\"}}";
+
+    uint64_t committed = buffer->committed.load(std::memory_order_acquire);
+    uint64_t first =
+        committed > ZONES_PER_THREAD ? committed - ZONES_PER_THREAD : 0;
+
+    std::vector<std::array<int64_t, 2>> times;
+    std::vector<const char*> names;
+    for (uint64_t i = first; i < committed; ++i) {
+      const Zone& zone = buffer->zones[i & (ZONES_PER_THREAD - 1)];
+      names.push_back(zone.name.load(std::memory_order_relaxed));
+      times.push_back({zone.begin.load(std::memory_order_relaxed),
+                       zone.end.load(std::memory_order_relaxed)});
+    }
+
+    // Slots reserved again while copying may hold torn zones, skip them
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t reserved = buffer->reserved.load(std::memory_order_relaxed);
+    uint64_t valid =
+        reserved > ZONES_PER_THREAD ? reserved - ZONES_PER_THREAD : 0;
+
+    for (uint64_t i = std::max(first, valid); i < committed; ++i) {
+      size_t slot = static_cast<size_t>(i - first);
+      out += ",\n{\"name\":\"";
+      appendEscaped(out, names[slot]);
+      out += std::format(
+          "\",\"cat\":\"uranium\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},"
+          "\"pid\":1,\"tid\":{}}}",
+          (times[slot][0] - epoch) / 1e3,
+          (times[slot][1] - times[slot][0]) / 1e3, buffer->thread);
+      ++zones;
+    }
+
+    std::fwrite(out.data(), 1, out.size(), file);
+    out.clear();
+  }
+
+  out += "\n]}\n";
+  std::fwrite(out.data(), 1, out.size(), file);
+  bool written = std::fclose(file) == 0;
+
+  if (written) {
+    Logger::UR_INFO(LogCategory::ENGINE, "Wrote {} profiler zones to {}.",
+                    zones, path);
+  } else {
+    Logger::UR_ERROR(LogCategory::ENGINE, "Cannot write the trace to {}.",
+                     path);
+  }
+  return written;
+}
@@ -0,0 +1,198 @@
+#include "uranium/core/SystemScheduler.hpp"
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
+#include "uranium/core/Logger.hpp"
+#include "uranium/core/Profiler.hpp"
+
+using namespace uranium::core;
+
+static int64_t now() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+SystemScheduler::SystemScheduler() noexcept
+    : systems(),
+      dirty(false),
+      names(),
+      remaining(),
+      jobs(nullptr),
+      frame(nullptr),
+      dt(0.0),
+      frame_start(0),
+      last() {}
+
+SystemScheduler::SystemID SystemScheduler::add(
+    std::string_view name, Run run, std::initializer_list<Access> access) {
+  names.emplace_back(name);
+  systems.push_back(System{names.back().c_str(), std::move(run),
+                           std::vector<Access>(access), true, {}, {}});
+  dirty = true;
+  return static_cast<SystemID>(systems.size() - 1);
+}
+
+void SystemScheduler::remove(SystemID id) {
+  if (id < systems.size() && systems[id].alive) {
+    systems[id].alive = false;
+    systems[id].run.reset();
+    dirty = true;
+  }
+}
+
+void SystemScheduler::run(JobSystem& jobs, double dt) {
+  if (dirty) {
+    build();
+  }
+
+  this->jobs = &jobs;
+  this->dt = dt;
+  last.systems.assign(systems.size(), Timing{0.0, 0.0});
+
+  JobCounter counter;
+  frame = &counter;
+  frame_start = now();
+
+  // Roots first, the others are launched by their last dependency
+  for (SystemID id = 0; id < systems.size(); ++id) {
+    const System& system = systems[id];
+    remaining[id].store(static_cast<uint32_t>(system.dependencies.size()),
+                        std::memory_order_relaxed);
+  }
+  for (SystemID id = 0; id < systems.size(); ++id) {
+    if (systems[id].alive && systems[id].dependencies.empty()) {
+      launch(id);
+    }
+  }
+
+  jobs.wait(counter);
+  last.frame_time = (now() - frame_start) / 1e6;
+  frame = nullptr;
+
+  findCriticalPath();
+}
+
+const SystemScheduler::Report& SystemScheduler::report() const noexcept {
+  return last;
+}
+
+std::string_view SystemScheduler::nameOf(SystemID id) const {
+  return id < systems.size() ? std::string_view(systems[id].name) : "";
+}
+
+void SystemScheduler::logCriticalPath() const {
+  std::string path;
+  for (SystemID id : last.critical_path) {
+    path += std::format("{}{} ({:.3f} ms)", path.empty() ? "" : " -> ",
+                        systems[id].name, last.systems[id].duration);
+  }
+  Logger::UR_INFO(LogCategory::ENGINE,
+                  "Critical path {:.3f} ms of a {:.3f} ms frame: {}",
+                  last.critical_time, last.frame_time, path);
+}
+
+void SystemScheduler::build() {
+  // Last writer and readers since then, per resource
+  struct Users {
+    SystemID writer = UINT32_MAX;
+    std::vector<SystemID> readers;
+  };
+  std::unordered_map<ResourceID, Users> users;
+
+  for (System& system : systems) {
+    system.dependencies.clear();
+    system.dependents.clear();
+  }
+
+  for (SystemID id = 0; id < systems.size(); ++id) {
+    System& system = systems[id];
+    if (!system.alive) {
+      continue;
+    }
+
+    auto depend = [&](SystemID on) {
+      if (on == id) {
+        return;
+      }
+      for (SystemID existing : system.dependencies) {
+        if (existing == on) {
+          return;
+        }
+      }
+      system.dependencies.push_back(on);
+      systems[on].dependents.push_back(id);
+    };
+
+    for (const Access& access : system.access) {
+      Users& user = users[access.resource];
+      if (user.writer != UINT32_MAX) {
+        depend(user.writer);
+      }
+      if (access.write) {
+        for (SystemID reader : user.readers) {
+          depend(reader);
+        }
+        user.writer = id;
+        user.readers.clear();
+      } else {
+        user.readers.push_back(id);
+      }
+    }
+  }
+
+  remaining = std::make_unique<std::atomic<uint32_t>[]>(systems.size());
+  dirty = false;
+}
+
+void SystemScheduler::launch(SystemID id) {
+  jobs->run([this, id] { execute(id); }, frame);
+}
+
+void SystemScheduler::execute(SystemID id) {
+  int64_t start = now();
+  {
+    UR_PROFILE_SCOPE(systems[id].name);
+    systems[id].run(dt);
+  }
+  int64_t end = now();
+  last.systems[id] = Timing{(start - frame_start) / 1e6, (end - start) / 1e6};
+
+  // The last dependency to finish launches the dependent
+  for (SystemID dependent : systems[id].dependents) {
+    if (remaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      launch(dependent);
+    }
+  }
+}
+
+void SystemScheduler::findCriticalPath() {
+  // Dependencies always come first, registration order is topological
+  std::vector<double> finish(systems.size(), 0.0);
+  std::vector<SystemID> previous(systems.size(), UINT32_MAX);
+  SystemID tail = UINT32_MAX;
+
+  for (SystemID id = 0; id < systems.size(); ++id) {
+    if (!systems[id].alive) {
+      continue;
+    }
+    for (SystemID dependency : systems[id].dependencies) {
+      if (finish[dependency] > finish[id]) {
+        finish[id] = finish[dependency];
+        previous[id] = dependency;
+      }
+    }
+    finish[id] += last.systems[id].duration;
+    if (tail == UINT32_MAX || finish[id] > finish[tail]) {
+      tail = id;
+    }
+  }
+
+  last.critical_path.clear();
+  last.critical_time = tail == UINT32_MAX ? 0.0 : finish[tail];
+  for (SystemID id = tail; id != UINT32_MAX; id = previous[id]) {
+    last.critical_path.insert(last.critical_path.begin(), id);
+  }
+}
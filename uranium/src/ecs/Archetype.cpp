@@ -0,0 +1,118 @@
+#include "uranium/ecs/Archetype.hpp"
+
+#include <algorithm>
+#include <exception>
+
+#include "uranium/core/Logger.hpp"
+
+using namespace uranium::core;
+using namespace uranium::ecs;
+
+/**
+ * @brief Places the arrays of a chunk of the given capacity.
+ *
+ * @return false if they overflow the chunk.
+ */
+static bool layout(const std::vector<ComponentId>& ids, size_t capacity,
+                   std::vector<size_t>& offsets) noexcept {
+  size_t offset = capacity * sizeof(Entity);
+  for (size_t i = 0; i < ids.size(); ++i) {
+    const ComponentInfo& info = ComponentRegistry::info(ids[i]);
+    size_t alignment = std::max<size_t>(info.alignment, UR_CACHE_LINE);
+    offset = (offset + alignment - 1) & ~(alignment - 1);
+    offsets[i] = offset;
+    offset += capacity * info.size;
+  }
+  return offset <= Archetype::CHUNK_SIZE;
+}
+
+Archetype::Archetype(const Signature& signature,
+                     memory::PoolAllocator& allocator)
+    : types(signature),
+      ids(),
+      offsets(),
+      columns(),
+      chunk_capacity(0),
+      rows(0),
+      chunks(),
+      pool(allocator),
+      with(),
+      without() {
+  columns.fill(NO_COLUMN);
+  size_t row_size = sizeof(Entity);
+  for (size_t id = 0; id < MAX_COMPONENTS; ++id) {
+    if (signature.test(id)) {
+      columns[id] = static_cast<uint16_t>(ids.size());
+      ids.push_back(static_cast<ComponentId>(id));
+      row_size += ComponentRegistry::info(ids.back()).size;
+    }
+  }
+  offsets.resize(ids.size());
+
+  // Start from the capacity without padding, shrink until the arrays fit
+  size_t capacity = CHUNK_SIZE / row_size;
+  while (capacity > 0 && !layout(ids, capacity, offsets)) {
+    --capacity;
+  }
+  if (capacity == 0) {
+    Logger::UR_FATAL(LogCategory::ENGINE,
+                     "An entity of {} bytes does not fit a chunk.", row_size);
+    std::terminate();
+  }
+  chunk_capacity = static_cast<uint32_t>(capacity);
+}
+
+Archetype::~Archetype() noexcept {
+  for (size_t c = 0; c < chunks.size(); ++c) {
+    for (ComponentId id : ids) {
+      const ComponentInfo& info = ComponentRegistry::info(id);
+      if (info.destroy_fn) {
+        std::byte* array = static_cast<std::byte*>(column(c, id));
+        for (uint32_t i = 0; i < chunks[c].count; ++i) {
+          info.destroy_fn(array + i * info.size);
+        }
+      }
+    }
+    pool.deallocate(chunks[c].data, CHUNK_SIZE, memory::Tag::ENGINE);
+  }
+}
+
+uint32_t Archetype::push(Entity entity) {
+  if (rows == chunks.size() * chunk_capacity) {
+    void* data = pool.allocate(CHUNK_SIZE, UR_CACHE_LINE, memory::Tag::ENGINE);
+    chunks.push_back({static_cast<std::byte*>(data), 0});
+  }
+  Chunk& last = chunks.back();
+  entities(chunks.size() - 1)[last.count++] = entity;
+  return rows++;
+}
+
+Entity Archetype::erase(uint32_t row, bool constructed) noexcept {
+  uint32_t last = rows - 1;
+  for (ComponentId id : ids) {
+    const ComponentInfo& info = ComponentRegistry::info(id);
+    void* removed = component(row, id);
+    if (constructed) {
+      info.destroy(removed);
+    }
+    if (row != last) {
+      void* moved = component(last, id);
+      info.move(removed, moved);
+      info.destroy(moved);
+    }
+  }
+
+  Entity moved = NO_ENTITY;
+  if (row != last) {
+    moved = entities(last / chunk_capacity)[last % chunk_capacity];
+    entities(row / chunk_capacity)[row % chunk_capacity] = moved;
+  }
+
+  // Empty chunks go back to the pool, so sparse tables stay small
+  --rows;
+  if (--chunks.back().count == 0) {
+    pool.deallocate(chunks.back().data, CHUNK_SIZE, memory::Tag::ENGINE);
+    chunks.pop_back();
+  }
+  return moved;
+}
@@ -0,0 +1,29 @@
+#include "uranium/ecs/CommandBuffer.hpp"
+
+using namespace uranium::ecs;
+
+CommandBuffer::CommandBuffer(size_t capacity)
+    : commands(), payloads(capacity), created(0) {}
+
+CommandBuffer::~CommandBuffer() noexcept { clear(); }
+
+Entity CommandBuffer::create() {
+  Entity pending{created++, PENDING_GENERATION};
+  commands.push_back({Operation::CREATE, 0, pending, nullptr});
+  return pending;
+}
+
+void CommandBuffer::destroy(Entity entity) {
+  commands.push_back({Operation::DESTROY, 0, entity, nullptr});
+}
+
+void CommandBuffer::clear() noexcept {
+  for (Command& command : commands) {
+    if (command.operation == Operation::ADD && command.payload) {
+      ComponentRegistry::info(command.component).destroy(command.payload);
+    }
+  }
+  commands.clear();
+  payloads.reset();
+  created = 0;
+}
@@ -0,0 +1,51 @@
+#include "uranium/ecs/Component.hpp"
+
+#include <array>
+#include <atomic>
+#include <exception>
+#include <mutex>
+
+#include "uranium/core/Logger.hpp"
+
+using namespace uranium::core;
+using namespace uranium::ecs;
+
+/**
+ * @struct Registry
+ * @brief Layouts by id. An entry is written once, under the mutex, before
+ *        its id is handed out, so reading it needs no lock.
+ */
+struct Registry {
+  std::mutex mutex;
+  std::array<ComponentInfo, MAX_COMPONENTS> infos;
+  std::atomic<size_t> count{0};
+};
+
+static Registry& registry() {
+  static Registry instance;
+  return instance;
+}
+
+ComponentId ComponentRegistry::enroll(const ComponentInfo& info) {
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+
+  size_t id = r.count.load(std::memory_order_relaxed);
+  if (id == MAX_COMPONENTS) {
+    Logger::UR_FATAL(LogCategory::ENGINE,
+                     "More than {} component types registered.",
+                     MAX_COMPONENTS);
+    std::terminate();
+  }
+  r.infos[id] = info;
+  r.count.store(id + 1, std::memory_order_release);
+  return static_cast<ComponentId>(id);
+}
+
+const ComponentInfo& ComponentRegistry::info(ComponentId id) noexcept {
+  return registry().infos[id];
+}
+
+size_t ComponentRegistry::count() noexcept {
+  return registry().count.load(std::memory_order_acquire);
+}
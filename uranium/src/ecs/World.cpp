@@ -0,0 +1,211 @@
+#include "uranium/ecs/World.hpp"
+
+#include "uranium/core/Logger.hpp"
+
+using namespace uranium::core;
+using namespace uranium::ecs;
+
+World::World()
+    : chunks(Archetype::CHUNK_SIZE, UR_CACHE_LINE, CHUNKS_PER_SLAB),
+      archetypes(),
+      by_signature(),
+      empty(nullptr),
+      slots(),
+      free_slots(),
+      living(0),
+      iterating(0) {
+  empty = &archetypeOf(Signature());
+}
+
+World::~World() noexcept {
+  // Archetypes first, they return their chunks to the pool
+  archetypes.clear();
+}
+
+Entity World::create() { return spawn(Signature(), 0); }
+
+void World::destroy(Entity entity) {
+  if (!structural("destroy") || !alive(entity)) {
+    return;
+  }
+  Slot& slot = slots[entity.index];
+  Entity moved = slot.archetype->erase(slot.row, true);
+  if (moved != NO_ENTITY) {
+    slots[moved.index].row = slot.row;
+  }
+
+  // Skip the generation reserved for pending handles
+  slot.archetype = nullptr;
+  if (++slot.generation >= PENDING_GENERATION) {
+    slot.generation = 0;
+  }
+  free_slots.push_back(entity.index);
+  --living;
+}
+
+bool World::alive(Entity entity) const noexcept {
+  return entity.index < slots.size() &&
+         slots[entity.index].generation == entity.generation &&
+         slots[entity.index].archetype != nullptr;
+}
+
+void World::apply(CommandBuffer& commands) {
+  using Operation = CommandBuffer::Operation;
+  if (!structural("apply commands")) {
+    return;
+  }
+  std::vector<Entity> created;
+
+  for (CommandBuffer::Command& command : commands.commands) {
+    Entity entity = command.entity;
+    if (entity.generation == PENDING_GENERATION) {
+      entity = entity.index < created.size() ? created[entity.index]
+                                             : NO_ENTITY;
+    }
+
+    switch (command.operation) {
+      case Operation::CREATE:
+        created.push_back(create());
+        break;
+      case Operation::DESTROY:
+        destroy(entity);
+        break;
+      case Operation::ADD: {
+        const ComponentInfo& info = ComponentRegistry::info(command.component);
+        auto [storage, constructed] = emplace(entity, command.component);
+        if (storage) {
+          if (constructed) {
+            info.destroy(storage);
+          }
+          info.move(storage, command.payload);
+        }
+        info.destroy(command.payload);
+        command.payload = nullptr;
+        break;
+      }
+      case Operation::REMOVE:
+        erase(entity, command.component);
+        break;
+    }
+  }
+  commands.clear();
+}
+
+Archetype& World::archetypeOf(const Signature& signature) {
+  auto found = by_signature.find(signature);
+  if (found != by_signature.end()) {
+    return *found->second;
+  }
+  archetypes.push_back(std::make_unique<Archetype>(signature, chunks));
+  Archetype* archetype = archetypes.back().get();
+  by_signature.emplace(signature, archetype);
+  return *archetype;
+}
+
+Entity World::spawn(const Signature& signature, size_t types) {
+  if (!structural("create")) {
+    return NO_ENTITY;
+  }
+  if (signature.count() != types) {
+    Logger::UR_ERROR(LogCategory::ENGINE,
+                     "An entity cannot have a component twice.");
+    return NO_ENTITY;
+  }
+
+  uint32_t index;
+  if (!free_slots.empty()) {
+    index = free_slots.back();
+    free_slots.pop_back();
+  } else {
+    index = static_cast<uint32_t>(slots.size());
+    slots.emplace_back();
+  }
+
+  Slot& slot = slots[index];
+  Entity entity{index, slot.generation};
+  slot.archetype = signature.none() ? empty : &archetypeOf(signature);
+  slot.row = slot.archetype->push(entity);
+  ++living;
+  return entity;
+}
+
+void World::move(Slot& slot, Archetype& to) {
+  Archetype& from = *slot.archetype;
+  Entity entity = from.entities(slot.row / from.capacity())
+                      [slot.row % from.capacity()];
+  uint32_t row = to.push(entity);
+
+  // Move the shared components, destroy the ones left behind
+  for (ComponentId id : from.ids) {
+    const ComponentInfo& info = ComponentRegistry::info(id);
+    void* source = from.component(slot.row, id);
+    if (to.has(id)) {
+      info.move(to.component(row, id), source);
+    }
+    info.destroy(source);
+  }
+
+  Entity moved = from.erase(slot.row, false);
+  if (moved != NO_ENTITY) {
+    slots[moved.index].row = slot.row;
+  }
+  slot.archetype = &to;
+  slot.row = row;
+}
+
+std::pair<void*, bool> World::emplace(Entity entity, ComponentId id) {
+  if (!structural("add a component") || !alive(entity)) {
+    return {nullptr, false};
+  }
+  Slot& slot = slots[entity.index];
+  Archetype& from = *slot.archetype;
+  if (from.has(id)) {
+    return {from.component(slot.row, id), true};
+  }
+
+  Archetype*& to = from.with[id];
+  if (!to) {
+    to = &archetypeOf(Signature(from.signature()).set(id));
+    to->without[id] = &from;
+  }
+  move(slot, *to);
+  return {to->component(slot.row, id), false};
+}
+
+void World::erase(Entity entity, ComponentId id) {
+  if (!structural("remove a component") || !alive(entity)) {
+    return;
+  }
+  Slot& slot = slots[entity.index];
+  Archetype& from = *slot.archetype;
+  if (!from.has(id)) {
+    return;
+  }
+
+  Archetype*& to = from.without[id];
+  if (!to) {
+    to = &archetypeOf(Signature(from.signature()).reset(id));
+    to->with[id] = &from;
+  }
+  move(slot, *to);
+}
+
+void* World::find(Entity entity, ComponentId id) const noexcept {
+  if (!alive(entity)) {
+    return nullptr;
+  }
+  const Slot& slot = slots[entity.index];
+  return slot.archetype->has(id) ? slot.archetype->component(slot.row, id)
+                                 : nullptr;
+}
+
+bool World::structural(const char* operation) const noexcept {
+  if (iterating > 0) {
+    Logger::UR_ERROR(LogCategory::ENGINE,
+                     "Cannot {} while a query iterates, record it in a "
+                     "CommandBuffer.",
+                     operation);
+    return false;
+  }
+  return true;
+}
@@ -1,82 +1,317 @@
 #include "uranium/event/DynamicEventManager.hpp"
 
+#include <algorithm>
+
+#include "uranium/core/Profiler.hpp"
 #include "uranium/core/Utils.hpp"
 
 using namespace uranium::event;
 
+static TimerWheel::Tick toTicks(DynamicEventManager::Duration duration) {
+  using Duration = DynamicEventManager::Duration;
+  constexpr Duration resolution = DynamicEventManager::TIMER_RESOLUTION;
+
+  // Round up so an event never fires earlier than requested
+  duration = std::max(duration, Duration(0));
+  return static_cast<TimerWheel::Tick>(
+      (duration + resolution - Duration(1)) / resolution);
+}
+
 DynamicEventManager::DynamicEventManager() noexcept
-    : listeners(), event_buffers() {}
+    : arena(),
+      event_buffers(),
+      coalescers(),
+      recorder(nullptr),
+      dependencies(),
+      staged(),
+      grouped(),
+      parallel_jobs(),
+      slots(),
+      timers(),
+      timer_remainder(0),
+      listeners(),
+      category_listeners(),
+      category_interest(IEvent::NONE) {}
 
 DynamicEventManager::~DynamicEventManager() noexcept { this->clear(); }
 
-DynamicEventManager::ListenerID DynamicEventManager::add(IEvent::Type type,
-                                                         Listener listener) {
-  // Generate a new listener id
-  ListenerID id = next_listener_id++;
+DynamicEventManager::ListenerID DynamicEventManager::add(
+    IEvent::Type type, Listener listener, Concurrency concurrency) {
+  // Grow the table so the event type can be used as an index
+  if (type >= listeners.size()) {
+    listeners.resize(static_cast<size_t>(type) + 1);
+  }
 
-  // Store the new listener linked to the generated ID
-  listeners[type].push_back(ListenerEntry{id, std::move(listener)});
-  return id;
+  // Store the new listener, the handle doubles as its ID
+  return listeners[type].add(0, std::move(listener), concurrency);
+}
+
+void DynamicEventManager::addPermanent(IEvent::Type type, Listener listener,
+                                       Concurrency concurrency) {
+  // The handle is dropped, so the listener can never be removed
+  add(type, std::move(listener), concurrency);
 }
 
 bool DynamicEventManager::remove(IEvent::Type type, ListenerID id) {
-  // Look up the listener list for the given type
-  auto it = listeners.find(type);
-  if (it == listeners.end()) {
+  if (type >= listeners.size()) {
     return false;  // No listeners registered for this type
   }
+  return listeners[type].remove(id);
+}
 
-  auto& vec = it->second;
-  auto original_size = vec.size();
+DynamicEventManager::ListenerID DynamicEventManager::addCategory(
+    IEvent::CategoryMask categories, Listener listener) {
+  category_interest |= categories;
+  return category_listeners.add(0, std::move(listener),
+                                Concurrency::MAIN_THREAD, categories);
+}
 
-  // Remove the listener with the matching ID
-  vec.erase(std::remove_if(
-                vec.begin(), vec.end(),
-                [id](const ListenerEntry& entry) { return entry.id == id; }),
-            vec.end());
+bool DynamicEventManager::removeCategory(ListenerID id) {
+  if (!category_listeners.remove(id)) {
+    return false;
+  }
+  category_interest = category_listeners.categories();
+  return true;
+}
 
-  // If the vector is empty, remove the entry from the map entirely
-  if (vec.empty()) {
-    listeners.erase(it);
+void DynamicEventManager::raise(Priority priority, IEvent* event) {
+  if (recorder) {
+    recorder->record(static_cast<uint32_t>(priority), *event);
   }
+  event_buffers[static_cast<size_t>(priority)].push(event);
+}
 
-  // Return true if a listener was removed
-  return vec.size() < original_size;
+DynamicEventManager::TimerID DynamicEventManager::raiseAfter(
+    Duration delay, Priority priority, IEvent* event) {
+  return timers.schedule(toTicks(delay), 0, event,
+                         static_cast<uint32_t>(priority));
 }
 
-void DynamicEventManager::raise(Priority priority, IEvent* event) {
-  event_buffers[static_cast<size_t>(priority)].push_back(event);
+DynamicEventManager::TimerID DynamicEventManager::raiseEvery(
+    Duration period, Priority priority, IEvent* event) {
+  TimerWheel::Tick ticks = std::max<TimerWheel::Tick>(toTicks(period), 1);
+  return timers.schedule(ticks, ticks, event, static_cast<uint32_t>(priority));
+}
+
+bool DynamicEventManager::cancel(TimerID id) { return timers.cancel(id); }
+
+void DynamicEventManager::update(Duration elapsed) {
+  UR_PROFILE_SCOPE("DynamicEventManager::update");
+  // Keep the time that does not make up a whole tick for the next update
+  timer_remainder += std::max(elapsed, Duration(0));
+  auto ticks = timer_remainder / TIMER_RESOLUTION;
+  timer_remainder -= ticks * TIMER_RESOLUTION;
+
+  timers.advance(static_cast<TimerWheel::Tick>(ticks),
+                 [this](IEvent& event, uint32_t channel) {
+                   raise(static_cast<Priority>(channel), &event);
+                 });
+}
+
+void DynamicEventManager::coalesce(IEvent::Type type,
+                                   EventCoalescer::Reducer reducer) {
+  for (auto& coalescer : coalescers) {
+    coalescer.enable(type, reducer);
+  }
+}
+
+void DynamicEventManager::stopCoalescing(IEvent::Type type) {
+  for (auto& coalescer : coalescers) {
+    coalescer.disable(type);
+  }
 }
 
 void DynamicEventManager::dispatch(Priority priority) {
+  UR_PROFILE_SCOPE("DynamicEventManager::dispatch");
   auto& queue = event_buffers[static_cast<size_t>(priority)];
-  while (!queue.empty()) {
-    // Obtain the first event from queue
-    IEvent* event = queue.back();
-    queue.pop_back();
-
-    // Check if there is a listener asociated to the event to handle
-    auto it = listeners.find(event->type);
-    UR_ASSERT(it == listeners.end());
-
-    // Handle the event linked to the listener
-    for (auto& entry : it->second) {
-      entry.callback(*event);
+  auto& coalescer = coalescers[static_cast<size_t>(priority)];
+
+  for (;;) {
+    // Listeners may raise more events, they are popped in the same pass
+    while (IEvent* event = queue.pop()) {
+      if (!coalescer.absorb(event)) {
+        deliver(*event);
+      }
+    }
+
+    IEvent* merged = coalescer.release();
+    if (!merged) {
+      break;
+    }
+
+    // Deliver the merged events, then drain whatever their listeners raised
+    do {
+      deliver(*merged);
+    } while ((merged = coalescer.release()) != nullptr);
+  }
+}
+
+void DynamicEventManager::setDependencies(
+    Priority stage, std::initializer_list<Priority> dependencies) {
+  uint32_t mask = 0;
+  for (Priority dependency : dependencies) {
+    mask |= 1u << static_cast<uint32_t>(dependency);
+  }
+  // A stage cannot wait on itself
+  mask &= ~(1u << static_cast<uint32_t>(stage));
+  this->dependencies[static_cast<size_t>(stage)] = mask;
+}
+
+void DynamicEventManager::dispatchParallel(const ParallelFor& parallel_for) {
+  UR_PROFILE_SCOPE("DynamicEventManager::dispatchParallel");
+  constexpr uint32_t all = (1u << PCOUNT) - 1;
+
+  const RangeTask task = [this](size_t begin, size_t end) {
+    for (size_t index = begin; index < end; ++index) {
+      const ParallelJob& job = parallel_jobs[index];
+      for (uint32_t i = job.first; i < job.first + job.count; ++i) {
+        job.table->invokeSlot(job.slot, *grouped[i]);
+      }
+    }
+  };
+
+  do {
+    uint32_t done = 0;
+    while (done != all) {
+      // Gather every stage whose dependencies have been dispatched
+      uint32_t wave = 0;
+      for (size_t p = 0; p < PCOUNT; ++p) {
+        if (!(done & (1u << p)) && (dependencies[p] & ~done) == 0) {
+          wave |= 1u << p;
+        }
+      }
+
+      // Dependency cycle, break it at the most important stage left
+      if (wave == 0) {
+        uint32_t left = all & ~done;
+        wave = left & (0u - left);
+      }
+
+      staged.clear();
+      for (size_t p = 0; p < PCOUNT; ++p) {
+        if (wave & (1u << p)) {
+          stage(p);
+        }
+      }
+
+      // Group the events of the whole wave by type, so a listener gets a
+      // single run per type. Stable, it keeps stage and raise order
+      grouped.assign(staged.begin(), staged.end());
+      std::stable_sort(grouped.begin(), grouped.end(),
+                       [](const IEvent* a, const IEvent* b) {
+                         return a->type < b->type;
+                       });
+
+      // One job per thread-safe listener and type it handles
+      parallel_jobs.clear();
+      for (size_t first = 0; first < grouped.size();) {
+        IEvent::Type type = grouped[first]->type;
+        size_t last = first + 1;
+        while (last < grouped.size() && grouped[last]->type == type) {
+          ++last;
+        }
+
+        if (type < listeners.size() && listeners[type].threadSafeCount() > 0) {
+          slots.clear();
+          listeners[type].collectThreadSafe(slots);
+          for (uint32_t slot : slots) {
+            parallel_jobs.push_back(
+                ParallelJob{&listeners[type], slot,
+                            static_cast<uint32_t>(first),
+                            static_cast<uint32_t>(last - first)});
+          }
+        }
+        first = last;
+      }
+
+      // Acts as the barrier before the dependent stages
+      parallel_for(parallel_jobs.size(), task);
+
+      // Main-thread listeners see the events in the order they were raised
+      for (IEvent* event : staged) {
+        if (event->type < listeners.size()) {
+          listeners[event->type].invoke(*event, Concurrency::MAIN_THREAD);
+        }
+        if ((event->categories & category_interest) != 0) {
+          category_listeners.invokeMatching(*event);
+        }
+      }
+
+      done |= wave;
+    }
+  } while (!drained());
+}
+
+void DynamicEventManager::dispatchParallel(core::JobSystem& jobs) {
+  dispatchParallel([&jobs](size_t count, const RangeTask& task) {
+    jobs.parallelFor(count, task, 1);
+  });
+}
+
+void DynamicEventManager::endFrame() noexcept {
+  // Arena events may still sit in a queue dispatched earlier this frame,
+  // those stay alive until the next endFrame()
+  arena.recycle();
+}
+
+void DynamicEventManager::stage(size_t priority) {
+  auto& queue = event_buffers[priority];
+  auto& coalescer = coalescers[priority];
+
+  while (IEvent* event = queue.pop()) {
+    if (!coalescer.absorb(event)) {
+      staged.push_back(event);
     }
   }
+  while (IEvent* merged = coalescer.release()) {
+    staged.push_back(merged);
+  }
+}
+
+bool DynamicEventManager::drained() const noexcept {
+  for (const auto& queue : event_buffers) {
+    if (!queue.empty()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void DynamicEventManager::capture(EventRecorder* recorder) noexcept {
+  this->recorder = recorder;
 }
 
 void DynamicEventManager::flush() {
   for (auto& queue : event_buffers) {
-    while (!queue.empty()) {
-      queue.pop_back();
-    }
+    queue.clear();
   }
+  for (auto& coalescer : coalescers) {
+    coalescer.clear();
+  }
+  arena.recycle();
 }
 
 void DynamicEventManager::clear() {
-  // Flush all events left in queue
+  // Flush all events left in queue, drop pending timers
   // And remove all listeners
   flush();
+  timers.clear();
   listeners.clear();
+  category_listeners.clear();
+  category_interest = IEvent::NONE;
+}
+
+void DynamicEventManager::deliver(IEvent& event) {
+  // Check if there is a listener asociated to the event to handle, a
+  // single AND tells whether any category listener wants it
+  bool typed = event.type < listeners.size();
+  bool categorized = (event.categories & category_interest) != 0;
+
+  // Handle the event linked to the listener
+  if (typed) {
+    listeners[event.type].invoke(event);
+  }
+  if (categorized) {
+    category_listeners.invokeMatching(event);
+  }
 }
@@ -0,0 +1,98 @@
+#include "uranium/event/EventArena.hpp"
+
+#include <algorithm>
+
+using namespace uranium::event;
+
+EventArena::EventArena() noexcept : active(0) {
+  for (Page& page : pages) {
+    page.current.store(newBlock(BLOCK_SIZE, nullptr));
+    page.cleanups.store(nullptr);
+  }
+}
+
+EventArena::~EventArena() noexcept {
+  for (Page& page : pages) {
+    wipe(page);
+
+    Block* block = page.current.load();
+    block->~Block();
+    ::operator delete(block);
+  }
+}
+
+void EventArena::recycle() noexcept {
+  // The inactive page holds events created before the previous recycle,
+  // those have been dispatched by now
+  uint32_t next = active.load(std::memory_order_relaxed) ^ 1;
+  wipe(pages[next]);
+  active.store(next, std::memory_order_release);
+}
+
+void EventArena::reset() noexcept {
+  wipe(pages[0]);
+  wipe(pages[1]);
+}
+
+void* EventArena::allocate(Page& page, size_t size, size_t align) {
+  // Reserve enough room to align the pointer inside the reservation
+  size_t need = size + align - 1;
+
+  for (;;) {
+    Block* block = page.current.load(std::memory_order_acquire);
+    size_t offset = block->offset.fetch_add(need, std::memory_order_relaxed);
+
+    if (offset + need <= block->capacity) {
+      uintptr_t address = reinterpret_cast<uintptr_t>(block + 1) + offset;
+      return reinterpret_cast<void*>((address + align - 1) & ~(align - 1));
+    }
+
+    // Block is exhausted, chain a new one unless another thread already did
+    std::lock_guard<std::mutex> lock(page.grow);
+    if (page.current.load(std::memory_order_relaxed) == block) {
+      page.current.store(newBlock(std::max(BLOCK_SIZE, need), block),
+                         std::memory_order_release);
+    }
+  }
+}
+
+void EventArena::track(Page& page, Cleanup* cleanup) noexcept {
+  cleanup->next = page.cleanups.load(std::memory_order_relaxed);
+  while (!page.cleanups.compare_exchange_weak(cleanup->next, cleanup,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+  }
+}
+
+void EventArena::wipe(Page& page) noexcept {
+  // Run the destructors of the objects that registered one
+  Cleanup* cleanup = page.cleanups.exchange(nullptr, std::memory_order_acquire);
+  while (cleanup) {
+    Cleanup* next = cleanup->next;
+    cleanup->destroy(cleanup->object);
+    cleanup = next;
+  }
+
+  Block* block = page.current.load(std::memory_order_acquire);
+  if (!block->next) {
+    block->offset.store(0, std::memory_order_relaxed);
+    return;
+  }
+
+  // The page outgrew its block, replace the chain with a single block big
+  // enough for the whole frame so the next one does not chain again
+  size_t capacity = 0;
+  while (block) {
+    Block* next = block->next;
+    capacity += block->capacity;
+    block->~Block();
+    ::operator delete(block);
+    block = next;
+  }
+  page.current.store(newBlock(capacity, nullptr), std::memory_order_release);
+}
+
+EventArena::Block* EventArena::newBlock(size_t capacity, Block* next) {
+  void* memory = ::operator new(sizeof(Block) + capacity);
+  return ::new (memory) Block{next, capacity, 0};
+}
@@ -0,0 +1,64 @@
+#include "uranium/event/EventCoalescer.hpp"
+
+using namespace uranium::event;
+
+EventCoalescer::EventCoalescer() noexcept
+    : rules(), held_types(), released(0) {}
+
+void EventCoalescer::enable(IEvent::Type type, Reducer reducer) {
+  // Grow the table so the event type can be used as an index
+  if (type >= rules.size()) {
+    rules.resize(static_cast<size_t>(type) + 1);
+  }
+
+  Rule& rule = rules[type];
+  rule.enabled = true;
+  rule.reducer = std::move(reducer);
+}
+
+void EventCoalescer::disable(IEvent::Type type) {
+  if (type < rules.size()) {
+    rules[type].enabled = false;
+    rules[type].reducer.reset();
+  }
+}
+
+bool EventCoalescer::absorb(IEvent* event) {
+  if (event->type >= rules.size() || !rules[event->type].enabled) {
+    return false;
+  }
+
+  Rule& rule = rules[event->type];
+  if (!rule.held) {
+    // First occurrence since the last release
+    rule.held = event;
+    held_types.push_back(event->type);
+  } else if (rule.reducer) {
+    rule.reducer(*rule.held, *event);
+  } else {
+    rule.held = event;
+  }
+  return true;
+}
+
+IEvent* EventCoalescer::release() noexcept {
+  if (released == held_types.size()) {
+    // Everything was released, start collecting from scratch
+    held_types.clear();
+    released = 0;
+    return nullptr;
+  }
+
+  Rule& rule = rules[held_types[released++]];
+  IEvent* event = rule.held;
+  rule.held = nullptr;
+  return event;
+}
+
+void EventCoalescer::clear() noexcept {
+  for (IEvent::Type type : held_types) {
+    rules[type].held = nullptr;
+  }
+  held_types.clear();
+  released = 0;
+}
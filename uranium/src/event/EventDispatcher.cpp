@@ -1,54 +1,108 @@
 #include "uranium/event/EventDispatcher.hpp"
 
+#include "uranium/core/Profiler.hpp"
 #include "uranium/core/Utils.hpp"
 
 using namespace uranium::event;
 
-EventDispatcher::EventDispatcher() noexcept : listeners(), event_queue() {}
+EventDispatcher::EventDispatcher() noexcept
+    : arena(),
+      event_queue(),
+      coalescer(),
+      recorder(nullptr),
+      listeners(),
+      category_listeners(),
+      category_interest(IEvent::NONE) {}
 
 EventDispatcher::~EventDispatcher() noexcept {
   // Clear all events and listeners
   this->clear();
 }
 
-void EventDispatcher::subscribe(IEvent::Type type, uint32_t priority,
-                                Listener listener) {
-  // Generate a new listener id
-  // Store the new listener linked to the generated ID
-  listeners[type].push_back(
-      {next_listener_id++, priority, std::move(listener)});
+EventDispatcher::ListenerID EventDispatcher::subscribe(IEvent::Type type,
+                                                      uint32_t priority,
+                                                      Listener listener) {
+  // Grow the table so the event type can be used as an index
+  if (type >= listeners.size()) {
+    listeners.resize(static_cast<size_t>(type) + 1);
+  }
+
+  // The table keeps listeners by descending priority as they are inserted
+  return listeners[type].add(priority, std::move(listener));
+}
+
+bool EventDispatcher::unsubscribe(IEvent::Type type, ListenerID id) {
+  if (type >= listeners.size()) {
+    return false;  // No listeners registered for this type
+  }
+  return listeners[type].remove(id);
+}
+
+EventDispatcher::ListenerID EventDispatcher::subscribeCategory(
+    IEvent::CategoryMask categories, uint32_t priority, Listener listener) {
+  category_interest |= categories;
+  return category_listeners.add(priority, std::move(listener),
+                                ListenerTable::Concurrency::MAIN_THREAD,
+                                categories);
+}
 
-  // Sort listeners for this type by descending priority
-  std::sort(listeners[type].begin(), listeners[type].end(),
-            [](const ListenerEntry& a, const ListenerEntry& b) {
-              // Higher priority first
-              return a.priority > b.priority;
-            });
+bool EventDispatcher::unsubscribeCategory(ListenerID id) {
+  if (!category_listeners.remove(id)) {
+    return false;
+  }
+  category_interest = category_listeners.categories();
+  return true;
 }
 
-void EventDispatcher::raise(IEvent* event) { event_queue.push_back(event); }
+void EventDispatcher::raise(IEvent* event) {
+  if (recorder) {
+    recorder->record(0, *event);
+  }
+  event_queue.push(event);
+}
+
+void EventDispatcher::capture(EventRecorder* recorder) noexcept {
+  this->recorder = recorder;
+}
+
+void EventDispatcher::coalesce(IEvent::Type type,
+                               EventCoalescer::Reducer reducer) {
+  coalescer.enable(type, std::move(reducer));
+}
+
+void EventDispatcher::stopCoalescing(IEvent::Type type) {
+  coalescer.disable(type);
+}
 
 void EventDispatcher::dispatch() {
-  while (!event_queue.empty()) {
-    // Obtain the first event from queue
-    IEvent* event = event_queue.back();
-    event_queue.pop_back();
-
-    // Check if there is a listener asociated to the event to handle
-    auto it = listeners.find(event->type);
-    UR_ASSERT(it == listeners.end());
-
-    // Handle the event linked to the listener
-    for (auto& entry : it->second) {
-      entry.callback(*event);
+  UR_PROFILE_SCOPE("EventDispatcher::dispatch");
+  for (;;) {
+    // Obtain the first event from queue, holding back coalesced ones
+    while (IEvent* event = event_queue.pop()) {
+      if (!coalescer.absorb(event)) {
+        deliver(*event);
+      }
     }
+
+    IEvent* merged = coalescer.release();
+    if (!merged) {
+      break;
+    }
+
+    // Deliver the merged events, then drain whatever their listeners raised
+    do {
+      deliver(*merged);
+    } while ((merged = coalescer.release()) != nullptr);
   }
+
+  // Every event raised in the previous frame has been handled by now
+  arena.recycle();
 }
 
 void EventDispatcher::flush() {
-  while (!event_queue.empty()) {
-    event_queue.pop_back();
-  }
+  event_queue.clear();
+  coalescer.clear();
+  arena.recycle();
 }
 
 void EventDispatcher::clear() {
@@ -56,4 +110,21 @@ void EventDispatcher::clear() {
   // And remove all listeners
   flush();
   listeners.clear();
+  category_listeners.clear();
+  category_interest = IEvent::NONE;
+}
+
+void EventDispatcher::deliver(IEvent& event) {
+  // Check if there is a listener asociated to the event to handle, a
+  // single AND tells whether any category listener wants it
+  bool typed = event.type < listeners.size();
+  bool categorized = (event.categories & category_interest) != 0;
+
+  // Handle the event linked to the listener
+  if (typed) {
+    listeners[event.type].invoke(event);
+  }
+  if (categorized) {
+    category_listeners.invokeMatching(event);
+  }
 }
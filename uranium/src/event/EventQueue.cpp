@@ -0,0 +1,63 @@
+#include "uranium/event/EventQueue.hpp"
+
+using namespace uranium::event;
+
+EventQueue::EventQueue() noexcept
+    : ring(), spill(), spilled(0), overflowed(0), dropped(0) {}
+
+EventQueue::~EventQueue() noexcept { this->clear(); }
+
+bool EventQueue::push(IEvent* event) noexcept {
+  // Keep spilling while older events are still in the spill ring, otherwise
+  // an event could overtake one raised earlier by the same thread
+  if (spilled.load(std::memory_order_acquire) == 0 && ring.tryPush(event)) {
+    return true;
+  }
+
+  // Ring is full, push the event into the spill ring
+  spilled.fetch_add(1, std::memory_order_acq_rel);
+  if (spill.tryPush(event)) {
+    overflowed.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  spilled.fetch_sub(1, std::memory_order_release);
+  dropped.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+IEvent* EventQueue::pop() noexcept {
+  IEvent* event = nullptr;
+  if (ring.tryPop(event)) {
+    return event;
+  }
+
+  // Check the spill ring before the ring. Whatever a thread pushed into the
+  // ring before spilling is then visible, and must be popped first. That
+  // includes an event a producer is still writing
+  if (!spill.ready() || !ring.empty()) {
+    return nullptr;
+  }
+
+  // Spilled events are newer than anything left in the ring
+  spill.tryPop(event);
+  spilled.fetch_sub(1, std::memory_order_release);
+  return event;
+}
+
+void EventQueue::clear() noexcept {
+  while (pop() != nullptr) {
+  }
+}
+
+bool EventQueue::empty() const noexcept {
+  return ring.empty() && spill.empty();
+}
+
+uint64_t EventQueue::overflowCount() const noexcept {
+  return overflowed.load(std::memory_order_relaxed);
+}
+
+uint64_t EventQueue::droppedCount() const noexcept {
+  return dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,230 @@
+#include "uranium/event/EventTrace.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "uranium/core/Logger.hpp"
+#include "uranium/event/DynamicEventManager.hpp"
+#include "uranium/event/EventDispatcher.hpp"
+
+using namespace uranium::core;
+using namespace uranium::event;
+
+static constexpr size_t HEADER_SIZE = 8;
+static constexpr size_t FRAME_SIZE = 1 + 8;
+static constexpr size_t EVENT_SIZE = 1 + 1 + 2 + 4;
+
+template <typename T>
+static T readAt(const std::vector<std::byte>& data, size_t offset) {
+  T value;
+  std::memcpy(&value, data.data() + offset, sizeof(T));
+  return value;
+}
+
+EventRecorder::EventRecorder() noexcept
+    : mutex(), file(), sizes(), start(), frame_start() {}
+
+EventRecorder::~EventRecorder() noexcept { this->close(); }
+
+bool EventRecorder::open(std::string_view path) {
+  close();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  file.open(std::string(path), std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    Logger::UR_ERROR(LogCategory::SYSTEM, "Cannot open event trace {}.",
+                     path);
+    return false;
+  }
+
+  write(trace::MAGIC);
+  write(trace::VERSION);
+  write(uint16_t(0));
+
+  start = Clock::now();
+  frame_start = start;
+  return true;
+}
+
+void EventRecorder::close() {
+  if (!recording()) {
+    return;
+  }
+
+  // Terminate the last frame so its events are replayed as well
+  frame();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  file.close();
+}
+
+void EventRecorder::traceable(IEvent::Type type, size_t size) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (type >= sizes.size()) {
+    sizes.resize(static_cast<size_t>(type) + 1, 0);
+  }
+  sizes[type] = static_cast<uint16_t>(size);
+}
+
+void EventRecorder::record(uint32_t channel, const IEvent& event) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!file.is_open() || event.type >= sizes.size() ||
+      sizes[event.type] == 0) {
+    return;  // Not traced
+  }
+
+  auto offset = std::chrono::duration_cast<std::chrono::microseconds>(
+      Clock::now() - frame_start);
+  uint16_t size = sizes[event.type];
+
+  write(trace::EVENT);
+  write(static_cast<uint8_t>(channel));
+  write(size);
+  write(static_cast<uint32_t>(
+      std::min<int64_t>(offset.count(), UINT32_MAX)));
+  file.write(reinterpret_cast<const char*>(&event), size);
+}
+
+void EventRecorder::frame() {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!file.is_open()) {
+    return;
+  }
+
+  frame_start = Clock::now();
+  auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+      frame_start - start);
+
+  write(trace::FRAME);
+  write(static_cast<uint64_t>(time.count()));
+}
+
+bool EventRecorder::recording() const noexcept { return file.is_open(); }
+
+EventReplayer::EventReplayer() noexcept
+    : data(),
+      cursor(0),
+      storage(),
+      events(),
+      frames(0),
+      last_time(0),
+      frame_elapsed(0) {}
+
+bool EventReplayer::load(std::string_view path) {
+  std::ifstream file(std::string(path), std::ios::binary | std::ios::ate);
+  if (!file.is_open()) {
+    Logger::UR_ERROR(LogCategory::SYSTEM, "Cannot open event trace {}.",
+                     path);
+    return false;
+  }
+
+  data.resize(static_cast<size_t>(file.tellg()));
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(data.data()),
+            static_cast<std::streamsize>(data.size()));
+
+  if (data.size() < HEADER_SIZE ||
+      readAt<uint32_t>(data, 0) != trace::MAGIC ||
+      readAt<uint16_t>(data, 4) != trace::VERSION) {
+    Logger::UR_ERROR(LogCategory::SYSTEM, "{} is not an event trace.", path);
+    data.clear();
+    return false;
+  }
+
+  rewind();
+  return true;
+}
+
+bool EventReplayer::next(EventDispatcher& dispatcher) {
+  if (!decodeFrame()) {
+    return false;
+  }
+  for (const Replayed& replayed : events) {
+    dispatcher.raise(replayed.event);
+  }
+  return true;
+}
+
+bool EventReplayer::next(DynamicEventManager& manager) {
+  using Priority = DynamicEventManager::Priority;
+
+  if (!decodeFrame()) {
+    return false;
+  }
+  for (const Replayed& replayed : events) {
+    if (replayed.channel < static_cast<uint32_t>(Priority::COUNT)) {
+      manager.raise(static_cast<Priority>(replayed.channel), replayed.event);
+    }
+  }
+  return true;
+}
+
+EventReplayer::Duration EventReplayer::elapsed() const noexcept {
+  return frame_elapsed;
+}
+
+size_t EventReplayer::frame() const noexcept { return frames; }
+
+void EventReplayer::rewind() noexcept {
+  cursor = HEADER_SIZE;
+  frames = 0;
+  last_time = 0;
+  frame_elapsed = Duration(0);
+  events.clear();
+}
+
+bool EventReplayer::decodeFrame() {
+  constexpr size_t align = sizeof(std::max_align_t);
+
+  events.clear();
+
+  // First pass, find the frame end and lay the events out in the storage
+  size_t position = cursor;
+  size_t used = 0;
+  for (;;) {
+    if (position + 1 > data.size()) {
+      return false;  // Truncated trace, or nothing left to replay
+    }
+
+    uint8_t tag = readAt<uint8_t>(data, position);
+    if (tag == trace::FRAME) {
+      if (position + FRAME_SIZE > data.size()) {
+        return false;
+      }
+      break;
+    }
+
+    if (tag != trace::EVENT || position + EVENT_SIZE > data.size()) {
+      return false;
+    }
+    uint8_t channel = readAt<uint8_t>(data, position + 1);
+    uint16_t size = readAt<uint16_t>(data, position + 2);
+    if (position + EVENT_SIZE + size > data.size()) {
+      return false;
+    }
+
+    events.push_back(Replayed{nullptr, used, channel});
+    used += (size + align - 1) / align * align;
+    position += EVENT_SIZE + size;
+  }
+
+  // Second pass, copy the payloads now that the storage is sized
+  storage.resize(used / align);
+  std::byte* base = reinterpret_cast<std::byte*>(storage.data());
+  size_t read = cursor;
+  for (Replayed& replayed : events) {
+    uint16_t size = readAt<uint16_t>(data, read + 2);
+    std::byte* target = base + replayed.offset;
+    std::memcpy(target, data.data() + read + EVENT_SIZE, size);
+    replayed.event = reinterpret_cast<IEvent*>(target);
+    read += EVENT_SIZE + size;
+  }
+
+  uint64_t time = readAt<uint64_t>(data, position + 1);
+  frame_elapsed = Duration(time - last_time);
+  last_time = time;
+  cursor = position + FRAME_SIZE;
+  ++frames;
+  return true;
+}
@@ -0,0 +1,196 @@
+#include "uranium/event/ListenerTable.hpp"
+
+#include <algorithm>
+
+using namespace uranium::event;
+
+ListenerTable::ListenerTable() noexcept
+    : slots(),
+      free_slots(),
+      order(),
+      pending(),
+      alive_count(0),
+      thread_safe_count(0),
+      dead_count(0),
+      dispatch_depth(0) {}
+
+ListenerTable::Handle ListenerTable::add(uint32_t priority, Listener listener,
+                                         Concurrency concurrency,
+                                         IEvent::CategoryMask categories) {
+  // Reuse a released slot when possible
+  uint32_t index;
+  if (!free_slots.empty()) {
+    index = free_slots.back();
+    free_slots.pop_back();
+  } else {
+    index = static_cast<uint32_t>(slots.size());
+    slots.push_back(
+        Slot{nullptr, 1, 0, Concurrency::MAIN_THREAD, IEvent::NONE, false});
+  }
+
+  Slot& slot = slots[index];
+  slot.callback = std::move(listener);
+  slot.priority = priority;
+  slot.concurrency = concurrency;
+  slot.categories = categories;
+  slot.alive = true;
+  ++alive_count;
+  if (concurrency == Concurrency::THREAD_SAFE) {
+    ++thread_safe_count;
+  }
+
+  // The order cannot change under an ongoing invoke, defer the insertion
+  if (dispatch_depth > 0) {
+    pending.push_back(index);
+  } else {
+    insert(index);
+  }
+
+  return (static_cast<Handle>(slot.generation) << 32) | index;
+}
+
+bool ListenerTable::remove(Handle handle) {
+  uint32_t index = static_cast<uint32_t>(handle);
+  uint32_t generation = static_cast<uint32_t>(handle >> 32);
+
+  if (index >= slots.size()) {
+    return false;
+  }
+
+  Slot& slot = slots[index];
+  if (!slot.alive || slot.generation != generation) {
+    return false;  // Already removed, or the slot has been reused
+  }
+
+  // The callback is kept until compaction, it may be the one running
+  slot.alive = false;
+  ++slot.generation;
+  --alive_count;
+  ++dead_count;
+  if (slot.concurrency == Concurrency::THREAD_SAFE) {
+    --thread_safe_count;
+  }
+
+  if (dispatch_depth == 0 && dead_count * 2 > order.size()) {
+    compact();
+  }
+  return true;
+}
+
+void ListenerTable::invoke(IEvent& event) {
+  ++dispatch_depth;
+  for (size_t i = 0; i < order.size(); ++i) {
+    Slot& slot = slots[order[i]];
+    if (slot.alive) {
+      slot.callback(event);
+    }
+  }
+  --dispatch_depth;
+  settle();
+}
+
+void ListenerTable::invoke(IEvent& event, Concurrency only) {
+  ++dispatch_depth;
+  for (size_t i = 0; i < order.size(); ++i) {
+    Slot& slot = slots[order[i]];
+    if (slot.alive && slot.concurrency == only) {
+      slot.callback(event);
+    }
+  }
+  --dispatch_depth;
+  settle();
+}
+
+void ListenerTable::invokeMatching(IEvent& event) {
+  ++dispatch_depth;
+  for (size_t i = 0; i < order.size(); ++i) {
+    Slot& slot = slots[order[i]];
+    if (slot.alive && (slot.categories & event.categories) != 0) {
+      slot.callback(event);
+    }
+  }
+  --dispatch_depth;
+  settle();
+}
+
+void ListenerTable::collectThreadSafe(std::vector<uint32_t>& out) const {
+  for (uint32_t index : order) {
+    const Slot& slot = slots[index];
+    if (slot.alive && slot.concurrency == Concurrency::THREAD_SAFE) {
+      out.push_back(index);
+    }
+  }
+}
+
+void ListenerTable::invokeSlot(uint32_t slot, IEvent& event) const {
+  slots[slot].callback(event);
+}
+
+void ListenerTable::settle() {
+  if (dispatch_depth > 0) {
+    return;
+  }
+
+  // Apply what the listeners changed while they were being invoked
+  for (uint32_t index : pending) {
+    insert(index);
+  }
+  pending.clear();
+
+  if (dead_count * 2 > order.size()) {
+    compact();
+  }
+}
+
+void ListenerTable::clear() {
+  slots.clear();
+  free_slots.clear();
+  order.clear();
+  pending.clear();
+  alive_count = 0;
+  thread_safe_count = 0;
+  dead_count = 0;
+}
+
+bool ListenerTable::empty() const noexcept { return alive_count == 0; }
+
+size_t ListenerTable::size() const noexcept { return alive_count; }
+
+size_t ListenerTable::threadSafeCount() const noexcept {
+  return thread_safe_count;
+}
+
+IEvent::CategoryMask ListenerTable::categories() const noexcept {
+  IEvent::CategoryMask mask = IEvent::NONE;
+  for (const Slot& slot : slots) {
+    if (slot.alive) {
+      mask |= slot.categories;
+    }
+  }
+  return mask;
+}
+
+void ListenerTable::insert(uint32_t index) {
+  // Place after every listener of higher or equal priority
+  uint32_t priority = slots[index].priority;
+  auto it = std::upper_bound(order.begin(), order.end(), priority,
+                             [this](uint32_t value, uint32_t other) {
+                               return value > slots[other].priority;
+                             });
+  order.insert(it, index);
+}
+
+void ListenerTable::compact() {
+  auto dead = std::remove_if(order.begin(), order.end(), [this](uint32_t i) {
+    Slot& slot = slots[i];
+    if (slot.alive) {
+      return false;
+    }
+    // Release the callback and hand the slot back for reuse
+    slot.callback.reset();
+    free_slots.push_back(i);
+    return true;
+  });
+  order.erase(dead, order.end());
+  dead_count = 0;
+}
@@ -0,0 +1,225 @@
+#include "uranium/event/TimerWheel.hpp"
+
+#include <algorithm>
+
+using namespace uranium::event;
+
+TimerWheel::TimerWheel() noexcept
+    : timers(), free_timers(), firing(), current(0), pending(0) {
+  for (auto& level : buckets) {
+    level.fill(NIL);
+  }
+  level_counts.fill(0);
+}
+
+TimerWheel::TimerID TimerWheel::schedule(Tick delay, Tick period,
+                                         IEvent* event, uint32_t channel) {
+  // Reuse a released timer when possible
+  uint32_t index;
+  if (!free_timers.empty()) {
+    index = free_timers.back();
+    free_timers.pop_back();
+  } else {
+    index = static_cast<uint32_t>(timers.size());
+    timers.push_back(Timer{});
+    timers[index].generation = 1;
+  }
+
+  Timer& timer = timers[index];
+  timer.expires = current + std::max<Tick>(delay, 1);
+  timer.period = period;
+  timer.event = event;
+  timer.channel = channel;
+  timer.active = true;
+  ++pending;
+
+  link(index);
+  return (static_cast<TimerID>(timer.generation) << 32) | index;
+}
+
+bool TimerWheel::cancel(TimerID id) {
+  uint32_t index = static_cast<uint32_t>(id);
+  uint32_t generation = static_cast<uint32_t>(id >> 32);
+
+  if (index >= timers.size()) {
+    return false;
+  }
+
+  Timer& timer = timers[index];
+  if (!timer.active || timer.generation != generation) {
+    return false;  // Already fired, or the timer has been reused
+  }
+
+  // A timer about to fire in the current step is not linked anymore
+  if (timer.level != UNLINKED) {
+    unlink(index);
+  }
+  release(index);
+  return true;
+}
+
+void TimerWheel::advance(Tick ticks, const Callback& callback) {
+  Tick target = current + ticks;
+
+  while (current < target) {
+    if (pending == 0) {
+      current = target;
+      break;
+    }
+
+    // With the first wheel empty nothing fires before it wraps around and
+    // the outer wheels cascade, so the ticks in between can be skipped
+    if (level_counts[0] == 0) {
+      Tick last = current | SLOT_MASK;
+      if (last >= target) {
+        current = target;
+        break;
+      }
+      current = last;
+    }
+
+    step(callback);
+  }
+}
+
+void TimerWheel::clear() {
+  timers.clear();
+  free_timers.clear();
+  firing.clear();
+  for (auto& level : buckets) {
+    level.fill(NIL);
+  }
+  level_counts.fill(0);
+  pending = 0;
+}
+
+size_t TimerWheel::size() const noexcept { return pending; }
+
+TimerWheel::Tick TimerWheel::now() const noexcept { return current; }
+
+void TimerWheel::link(uint32_t index) {
+  Timer& timer = timers[index];
+  Tick delta = timer.expires > current ? timer.expires - current : 0;
+
+  // Find the innermost wheel whose span covers the remaining delay
+  uint32_t level = 0;
+  while (level < LEVELS - 1 &&
+         delta >= (Tick(1) << (SLOT_BITS * (level + 1)))) {
+    ++level;
+  }
+
+  // Delays beyond the outermost wheel park at its far end and get
+  // redistributed with their real expiry once it comes around
+  Tick when = timer.expires;
+  if (delta >= (Tick(1) << (SLOT_BITS * LEVELS))) {
+    when = current + (Tick(1) << (SLOT_BITS * LEVELS)) - 1;
+  } else if (delta == 0) {
+    when = current;
+  }
+
+  uint32_t slot = static_cast<uint32_t>((when >> (SLOT_BITS * level)) &
+                                        SLOT_MASK);
+  uint32_t& head = buckets[level][slot];
+
+  timer.level = static_cast<uint8_t>(level);
+  timer.slot = static_cast<uint8_t>(slot);
+  timer.prev = NIL;
+  timer.next = head;
+  if (head != NIL) {
+    timers[head].prev = index;
+  }
+  head = index;
+  ++level_counts[level];
+}
+
+void TimerWheel::unlink(uint32_t index) {
+  Timer& timer = timers[index];
+
+  if (timer.prev != NIL) {
+    timers[timer.prev].next = timer.next;
+  } else {
+    buckets[timer.level][timer.slot] = timer.next;
+  }
+  if (timer.next != NIL) {
+    timers[timer.next].prev = timer.prev;
+  }
+
+  --level_counts[timer.level];
+  timer.level = UNLINKED;
+  timer.prev = NIL;
+  timer.next = NIL;
+}
+
+void TimerWheel::release(uint32_t index) {
+  Timer& timer = timers[index];
+  timer.active = false;
+  timer.level = UNLINKED;
+  ++timer.generation;
+  free_timers.push_back(index);
+  --pending;
+}
+
+void TimerWheel::cascade(uint32_t level) {
+  uint32_t slot = static_cast<uint32_t>(
+      (current >> (SLOT_BITS * level)) & SLOT_MASK);
+
+  // Detach the bucket and relink its timers closer to the first wheel
+  uint32_t index = buckets[level][slot];
+  buckets[level][slot] = NIL;
+
+  while (index != NIL) {
+    uint32_t next = timers[index].next;
+    --level_counts[level];
+    link(index);
+    index = next;
+  }
+}
+
+void TimerWheel::step(const Callback& callback) {
+  ++current;
+
+  // Outer wheels start a new bucket every time the wheel below wraps,
+  // cascade outermost first so timers can fall through several levels
+  for (uint32_t level = LEVELS - 1; level > 0; --level) {
+    Tick span = (Tick(1) << (SLOT_BITS * level)) - 1;
+    if ((current & span) == 0) {
+      cascade(level);
+    }
+  }
+
+  // Detach every timer expiring now before running any callback
+  uint32_t slot = static_cast<uint32_t>(current & SLOT_MASK);
+  uint32_t index = buckets[0][slot];
+  buckets[0][slot] = NIL;
+
+  while (index != NIL) {
+    Timer& timer = timers[index];
+    uint32_t next = timer.next;
+
+    --level_counts[0];
+    timer.level = UNLINKED;
+    firing.push_back({index, timer.generation});
+    index = next;
+  }
+
+  for (auto [index, generation] : firing) {
+    Timer& timer = timers[index];
+    if (!timer.active || timer.generation != generation) {
+      continue;  // Cancelled by a callback that ran before
+    }
+
+    // Copy out before the callback, it may schedule and grow the pool
+    IEvent* event = timer.event;
+    uint32_t channel = timer.channel;
+
+    if (timer.period > 0) {
+      timer.expires = current + timer.period;
+      link(index);
+    } else {
+      release(index);
+    }
+
+    callback(*event, channel);
+  }
+  firing.clear();
+}
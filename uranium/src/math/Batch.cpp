@@ -0,0 +1,166 @@
+#include "uranium/math/Batch.hpp"
+
+using namespace uranium::math;
+
+/**
+ * @brief Applies the upper 3x4 part of m to the points, with the
+ *        translation for points and without it for directions. Runs 8
+ *        points per iteration with AVX, 4 with SSE, then one at a time.
+ */
+template <bool POINTS>
+static void transform(const mat4& m, const PointsSoA& in,
+                      const PointsSoA& out, size_t count) noexcept {
+  size_t i = 0;
+
+#if defined(UR_MATH_AVX)
+  {
+    const __m256 m00 = _mm256_set1_ps(m[0].x), m01 = _mm256_set1_ps(m[0].y),
+                 m02 = _mm256_set1_ps(m[0].z);
+    const __m256 m10 = _mm256_set1_ps(m[1].x), m11 = _mm256_set1_ps(m[1].y),
+                 m12 = _mm256_set1_ps(m[1].z);
+    const __m256 m20 = _mm256_set1_ps(m[2].x), m21 = _mm256_set1_ps(m[2].y),
+                 m22 = _mm256_set1_ps(m[2].z);
+    const __m256 tx = _mm256_set1_ps(POINTS ? m[3].x : 0.0f),
+                 ty = _mm256_set1_ps(POINTS ? m[3].y : 0.0f),
+                 tz = _mm256_set1_ps(POINTS ? m[3].z : 0.0f);
+
+    for (; i + 8 <= count; i += 8) {
+      __m256 x = _mm256_loadu_ps(in.x + i);
+      __m256 y = _mm256_loadu_ps(in.y + i);
+      __m256 z = _mm256_loadu_ps(in.z + i);
+      __m256 rx = _mm256_add_ps(
+          _mm256_add_ps(_mm256_mul_ps(m00, x), _mm256_mul_ps(m10, y)),
+          _mm256_add_ps(_mm256_mul_ps(m20, z), tx));
+      __m256 ry = _mm256_add_ps(
+          _mm256_add_ps(_mm256_mul_ps(m01, x), _mm256_mul_ps(m11, y)),
+          _mm256_add_ps(_mm256_mul_ps(m21, z), ty));
+      __m256 rz = _mm256_add_ps(
+          _mm256_add_ps(_mm256_mul_ps(m02, x), _mm256_mul_ps(m12, y)),
+          _mm256_add_ps(_mm256_mul_ps(m22, z), tz));
+      _mm256_storeu_ps(out.x + i, rx);
+      _mm256_storeu_ps(out.y + i, ry);
+      _mm256_storeu_ps(out.z + i, rz);
+    }
+  }
+#endif
+
+#if defined(UR_MATH_SSE)
+  {
+    const __m128 m00 = _mm_set1_ps(m[0].x), m01 = _mm_set1_ps(m[0].y),
+                 m02 = _mm_set1_ps(m[0].z);
+    const __m128 m10 = _mm_set1_ps(m[1].x), m11 = _mm_set1_ps(m[1].y),
+                 m12 = _mm_set1_ps(m[1].z);
+    const __m128 m20 = _mm_set1_ps(m[2].x), m21 = _mm_set1_ps(m[2].y),
+                 m22 = _mm_set1_ps(m[2].z);
+    const __m128 tx = _mm_set1_ps(POINTS ? m[3].x : 0.0f),
+                 ty = _mm_set1_ps(POINTS ? m[3].y : 0.0f),
+                 tz = _mm_set1_ps(POINTS ? m[3].z : 0.0f);
+
+    for (; i + 4 <= count; i += 4) {
+      __m128 x = _mm_loadu_ps(in.x + i);
+      __m128 y = _mm_loadu_ps(in.y + i);
+      __m128 z = _mm_loadu_ps(in.z + i);
+      __m128 rx =
+          _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m10, y)),
+                     _mm_add_ps(_mm_mul_ps(m20, z), tx));
+      __m128 ry =
+          _mm_add_ps(_mm_add_ps(_mm_mul_ps(m01, x), _mm_mul_ps(m11, y)),
+                     _mm_add_ps(_mm_mul_ps(m21, z), ty));
+      __m128 rz =
+          _mm_add_ps(_mm_add_ps(_mm_mul_ps(m02, x), _mm_mul_ps(m12, y)),
+                     _mm_add_ps(_mm_mul_ps(m22, z), tz));
+      _mm_storeu_ps(out.x + i, rx);
+      _mm_storeu_ps(out.y + i, ry);
+      _mm_storeu_ps(out.z + i, rz);
+    }
+  }
+#endif
+
+  // Same operation order as the SIMD lanes, so every path agrees
+  const vec4 t = POINTS ? m[3] : vec4();
+  for (; i < count; ++i) {
+    float x = in.x[i], y = in.y[i], z = in.z[i];
+    out.x[i] = (m[0].x * x + m[1].x * y) + (m[2].x * z + t.x);
+    out.y[i] = (m[0].y * x + m[1].y * y) + (m[2].y * z + t.y);
+    out.z[i] = (m[0].z * x + m[1].z * y) + (m[2].z * z + t.z);
+  }
+}
+
+void uranium::math::transformPoints(const mat4& m, const PointsSoA& in,
+                                    const PointsSoA& out,
+                                    size_t count) noexcept {
+  transform<true>(m, in, out, count);
+}
+
+void uranium::math::transformVectors(const mat4& m, const PointsSoA& in,
+                                     const PointsSoA& out,
+                                     size_t count) noexcept {
+  transform<false>(m, in, out, count);
+}
+
+#if defined(UR_MATH_AVX)
+/**
+ * @brief A column repeated in both 128 bit lanes.
+ */
+static inline __m256 broadcast(const vec4& column) noexcept {
+  const __m128 lanes = column.simd();
+  return _mm256_set_m128(lanes, lanes);
+}
+
+/**
+ * @brief a * b computing two columns per AVX register: each 128 bit lane
+ *        holds a column of b, and in-lane shuffles broadcast its elements.
+ */
+static inline mat4 product(const mat4& a, const mat4& b) noexcept {
+  const __m256 a0 = broadcast(a[0]);
+  const __m256 a1 = broadcast(a[1]);
+  const __m256 a2 = broadcast(a[2]);
+  const __m256 a3 = broadcast(a[3]);
+
+  mat4 r;
+  for (size_t c = 0; c < 4; c += 2) {
+    __m256 columns = _mm256_loadu_ps(&b[c].x);
+    __m256 xy = _mm256_add_ps(
+        _mm256_mul_ps(a0, _mm256_shuffle_ps(columns, columns, 0x00)),
+        _mm256_mul_ps(a1, _mm256_shuffle_ps(columns, columns, 0x55)));
+    __m256 zw = _mm256_add_ps(
+        _mm256_mul_ps(a2, _mm256_shuffle_ps(columns, columns, 0xAA)),
+        _mm256_mul_ps(a3, _mm256_shuffle_ps(columns, columns, 0xFF)));
+    _mm256_storeu_ps(&r[c].x, _mm256_add_ps(xy, zw));
+  }
+  return r;
+}
+#else
+static inline mat4 product(const mat4& a, const mat4& b) noexcept {
+  return a * b;
+}
+#endif
+
+void uranium::math::multiply(const mat4* a, const mat4* b, mat4* out,
+                             size_t count) noexcept {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = product(a[i], b[i]);
+  }
+}
+
+mat4 uranium::math::multiplyChain(const mat4* matrices,
+                                  size_t count) noexcept {
+  if (count == 0) {
+    return mat4();
+  }
+  mat4 result = matrices[0];
+  for (size_t i = 1; i < count; ++i) {
+    result = product(result, matrices[i]);
+  }
+  return result;
+}
+
+void uranium::math::multiplyHierarchy(const mat4* locals,
+                                      const uint32_t* parents, mat4* worlds,
+                                      size_t count) noexcept {
+  for (size_t i = 0; i < count; ++i) {
+    worlds[i] = parents[i] == NO_PARENT
+                    ? locals[i]
+                    : product(worlds[parents[i]], locals[i]);
+  }
+}
@@ -0,0 +1,150 @@
+#include "uranium/math/Matrix.hpp"
+
+#include <cmath>
+
+#include "uranium/math/Quaternion.hpp"
+
+using namespace uranium::math;
+
+mat3::mat3(const mat4& m) noexcept
+    : columns{m[0].xyz(), m[1].xyz(), m[2].xyz()} {}
+
+mat4::mat4(const mat3& m) noexcept
+    : columns{vec4(m[0], 0.0f), vec4(m[1], 0.0f), vec4(m[2], 0.0f),
+              vec4(0.0f, 0.0f, 0.0f, 1.0f)} {}
+
+mat4 mat4::translation(const vec3& offset) noexcept {
+  mat4 m;
+  m[3] = vec4(offset, 1.0f);
+  return m;
+}
+
+mat4 mat4::scaling(const vec3& factors) noexcept {
+  mat4 m;
+  m[0].x = factors.x;
+  m[1].y = factors.y;
+  m[2].z = factors.z;
+  return m;
+}
+
+mat4 mat4::rotation(const quat& rotation) noexcept {
+  return mat4(toMat3(rotation));
+}
+
+mat4 mat4::perspective(float fovy, float aspect, float z_near,
+                       float z_far) noexcept {
+  float f = 1.0f / std::tan(0.5f * fovy);
+  float depth = 1.0f / (z_near - z_far);
+  return mat4(vec4(f / aspect, 0.0f, 0.0f, 0.0f), vec4(0.0f, f, 0.0f, 0.0f),
+              vec4(0.0f, 0.0f, (z_far + z_near) * depth, -1.0f),
+              vec4(0.0f, 0.0f, 2.0f * z_far * z_near * depth, 0.0f));
+}
+
+mat4 mat4::orthographic(float left, float right, float bottom, float top,
+                        float z_near, float z_far) noexcept {
+  float width = 1.0f / (right - left);
+  float height = 1.0f / (top - bottom);
+  float depth = 1.0f / (z_far - z_near);
+  return mat4(vec4(2.0f * width, 0.0f, 0.0f, 0.0f),
+              vec4(0.0f, 2.0f * height, 0.0f, 0.0f),
+              vec4(0.0f, 0.0f, -2.0f * depth, 0.0f),
+              vec4(-(right + left) * width, -(top + bottom) * height,
+                   -(z_far + z_near) * depth, 1.0f));
+}
+
+mat4 mat4::lookAt(const vec3& eye, const vec3& target,
+                  const vec3& up) noexcept {
+  vec3 forward = normalize(target - eye);
+  vec3 side = normalize(cross(forward, up));
+  vec3 above = cross(side, forward);
+  return mat4(vec4(side.x, above.x, -forward.x, 0.0f),
+              vec4(side.y, above.y, -forward.y, 0.0f),
+              vec4(side.z, above.z, -forward.z, 0.0f),
+              vec4(-dot(side, eye), -dot(above, eye), dot(forward, eye),
+                   1.0f));
+}
+
+mat3 uranium::math::inverse(const mat3& m) noexcept {
+  // The rows of the inverse are the cross products of the columns
+  vec3 r0 = cross(m[1], m[2]);
+  vec3 r1 = cross(m[2], m[0]);
+  vec3 r2 = cross(m[0], m[1]);
+  float det = dot(m[0], r0);
+  if (std::fabs(det) <= EPSILON * EPSILON) {
+    return mat3();
+  }
+  float inv = 1.0f / det;
+  return transpose(mat3(r0 * inv, r1 * inv, r2 * inv));
+}
+
+/**
+ * @struct Minors
+ * @brief 2x2 determinants of the two upper rows (s) and of the two lower
+ *        rows (c) of a 4x4 matrix, from which its determinant and its
+ *        cofactors follow by Laplace expansion.
+ */
+struct Minors {
+  float s[6];
+  float c[6];
+
+  explicit Minors(const mat4& m) noexcept {
+    // Expanded on columns instead of rows, the inverse of the transpose
+    // is the transpose of the inverse so the formulas still hold
+    s[0] = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+    s[1] = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+    s[2] = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+    s[3] = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+    s[4] = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+    s[5] = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+    c[5] = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+    c[4] = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+    c[3] = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+    c[2] = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+    c[1] = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+    c[0] = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+  }
+
+  float determinant() const noexcept {
+    return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] -
+           s[4] * c[1] + s[5] * c[0];
+  }
+};
+
+float uranium::math::determinant(const mat4& m) noexcept {
+  return Minors(m).determinant();
+}
+
+mat4 uranium::math::inverse(const mat4& m) noexcept {
+  Minors minors(m);
+  const float* s = minors.s;
+  const float* c = minors.c;
+
+  float det = minors.determinant();
+  if (std::fabs(det) <= EPSILON * EPSILON) {
+    return mat4();
+  }
+  float inv = 1.0f / det;
+
+  mat4 r;
+  r[0][0] = (m[1][1] * c[5] - m[1][2] * c[4] + m[1][3] * c[3]) * inv;
+  r[0][1] = (-m[0][1] * c[5] + m[0][2] * c[4] - m[0][3] * c[3]) * inv;
+  r[0][2] = (m[3][1] * s[5] - m[3][2] * s[4] + m[3][3] * s[3]) * inv;
+  r[0][3] = (-m[2][1] * s[5] + m[2][2] * s[4] - m[2][3] * s[3]) * inv;
+
+  r[1][0] = (-m[1][0] * c[5] + m[1][2] * c[2] - m[1][3] * c[1]) * inv;
+  r[1][1] = (m[0][0] * c[5] - m[0][2] * c[2] + m[0][3] * c[1]) * inv;
+  r[1][2] = (-m[3][0] * s[5] + m[3][2] * s[2] - m[3][3] * s[1]) * inv;
+  r[1][3] = (m[2][0] * s[5] - m[2][2] * s[2] + m[2][3] * s[1]) * inv;
+
+  r[2][0] = (m[1][0] * c[4] - m[1][1] * c[2] + m[1][3] * c[0]) * inv;
+  r[2][1] = (-m[0][0] * c[4] + m[0][1] * c[2] - m[0][3] * c[0]) * inv;
+  r[2][2] = (m[3][0] * s[4] - m[3][1] * s[2] + m[3][3] * s[0]) * inv;
+  r[2][3] = (-m[2][0] * s[4] + m[2][1] * s[2] - m[2][3] * s[0]) * inv;
+
+  r[3][0] = (-m[1][0] * c[3] + m[1][1] * c[1] - m[1][2] * c[0]) * inv;
+  r[3][1] = (m[0][0] * c[3] - m[0][1] * c[1] + m[0][2] * c[0]) * inv;
+  r[3][2] = (-m[3][0] * s[3] + m[3][1] * s[1] - m[3][2] * s[0]) * inv;
+  r[3][3] = (m[2][0] * s[3] - m[2][1] * s[1] + m[2][2] * s[0]) * inv;
+  return r;
+}
@@ -0,0 +1,98 @@
+#include "uranium/math/Quaternion.hpp"
+
+#include <cmath>
+
+using namespace uranium::math;
+
+// Blends are done on the four components as on a vec4
+static vec4 components(const quat& q) noexcept {
+  return vec4(q.x, q.y, q.z, q.w);
+}
+
+static quat fromComponents(const vec4& v) noexcept {
+  return quat(v.x, v.y, v.z, v.w);
+}
+
+quat quat::axisAngle(const vec3& axis, float angle) noexcept {
+  vec3 v = axis * std::sin(0.5f * angle);
+  return quat(v.x, v.y, v.z, std::cos(0.5f * angle));
+}
+
+quat quat::fromMatrix(const mat3& m) noexcept {
+  // Shepperd's method: divide by the largest of the four candidates so
+  // the square root never nears zero. m[c][r] is row r of column c
+  float trace = m[0].x + m[1].y + m[2].z;
+  if (trace > 0.0f) {
+    float s = 2.0f * std::sqrt(trace + 1.0f);
+    return quat((m[1].z - m[2].y) / s, (m[2].x - m[0].z) / s,
+                (m[0].y - m[1].x) / s, 0.25f * s);
+  }
+  if (m[0].x > m[1].y && m[0].x > m[2].z) {
+    float s = 2.0f * std::sqrt(1.0f + m[0].x - m[1].y - m[2].z);
+    return quat(0.25f * s, (m[1].x + m[0].y) / s, (m[2].x + m[0].z) / s,
+                (m[1].z - m[2].y) / s);
+  }
+  if (m[1].y > m[2].z) {
+    float s = 2.0f * std::sqrt(1.0f + m[1].y - m[0].x - m[2].z);
+    return quat((m[1].x + m[0].y) / s, 0.25f * s, (m[2].y + m[1].z) / s,
+                (m[2].x - m[0].z) / s);
+  }
+  float s = 2.0f * std::sqrt(1.0f + m[2].z - m[0].x - m[1].y);
+  return quat((m[2].x + m[0].z) / s, (m[2].y + m[1].z) / s, 0.25f * s,
+              (m[0].y - m[1].x) / s);
+}
+
+quat uranium::math::inverse(const quat& q) noexcept {
+  float squared = dot(q, q);
+  if (squared <= EPSILON * EPSILON) {
+    return quat();
+  }
+  return fromComponents(components(conjugate(q)) * (1.0f / squared));
+}
+
+quat uranium::math::normalize(const quat& q) noexcept {
+  float squared = dot(q, q);
+  if (squared <= EPSILON * EPSILON) {
+    return quat();
+  }
+  return fromComponents(components(q) * (1.0f / std::sqrt(squared)));
+}
+
+quat uranium::math::nlerp(const quat& a, const quat& b, float t) noexcept {
+  // q and -q are the same rotation, blend towards the closer one
+  vec4 from = components(a);
+  vec4 to = dot(a, b) < 0.0f ? -components(b) : components(b);
+  return normalize(fromComponents(lerp(from, to, t)));
+}
+
+quat uranium::math::slerp(const quat& a, const quat& b, float t) noexcept {
+  float cosine = dot(a, b);
+  vec4 to = components(b);
+  if (cosine < 0.0f) {
+    cosine = -cosine;
+    to = -to;
+  }
+
+  // Nearly parallel, the sine below would divide by almost zero
+  if (cosine > 1.0f - 1e-4f) {
+    return nlerp(a, b, t);
+  }
+
+  float angle = std::acos(cosine);
+  float sine = 1.0f / std::sin(angle);
+  float from_weight = std::sin((1.0f - t) * angle) * sine;
+  float to_weight = std::sin(t * angle) * sine;
+  return fromComponents(components(a) * from_weight + to * to_weight);
+}
+
+mat3 uranium::math::toMat3(const quat& q) noexcept {
+  float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+  float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+  float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+  return mat3(vec3(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz),
+                   2.0f * (xz - wy)),
+              vec3(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz),
+                   2.0f * (yz + wx)),
+              vec3(2.0f * (xz + wy), 2.0f * (yz - wx),
+                   1.0f - 2.0f * (xx + yy)));
+}
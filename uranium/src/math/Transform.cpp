@@ -0,0 +1,29 @@
+#include "uranium/math/Transform.hpp"
+
+using namespace uranium::math;
+
+mat4 Transform::toMatrix() const noexcept {
+  mat3 r = toMat3(rotation);
+  return mat4(vec4(r[0] * scale.x, 0.0f), vec4(r[1] * scale.y, 0.0f),
+              vec4(r[2] * scale.z, 0.0f), vec4(translation, 1.0f));
+}
+
+Transform uranium::math::operator*(const Transform& parent,
+                                   const Transform& child) noexcept {
+  return Transform(parent.transformPoint(child.translation),
+                   parent.rotation * child.rotation,
+                   parent.scale * child.scale);
+}
+
+Transform uranium::math::inverse(const Transform& t) noexcept {
+  vec3 scale(1.0f / t.scale.x, 1.0f / t.scale.y, 1.0f / t.scale.z);
+  quat rotation = conjugate(t.rotation);
+  return Transform((rotation * -t.translation) * scale, rotation, scale);
+}
+
+Transform uranium::math::interpolate(const Transform& a, const Transform& b,
+                                     float t) noexcept {
+  return Transform(lerp(a.translation, b.translation, t),
+                   slerp(a.rotation, b.rotation, t),
+                   lerp(a.scale, b.scale, t));
+}
@@ -0,0 +1,17 @@
+#include "uranium/memory/FrameAllocator.hpp"
+
+using namespace uranium::memory;
+
+FrameAllocator::FrameAllocator(size_t capacity)
+    : pages{LinearAllocator(capacity), LinearAllocator(capacity)},
+      active(0) {}
+
+size_t FrameAllocator::bytesOf(Tag tag) const noexcept {
+  return pages[0].bytesOf(tag) + pages[1].bytesOf(tag);
+}
+
+void FrameAllocator::beginFrame() noexcept {
+  // The other page holds the frame before the last one, no longer in use
+  active ^= 1;
+  pages[active].reset();
+}
@@ -0,0 +1,27 @@
+#include "uranium/memory/IAllocator.hpp"
+
+#include <string>
+
+using namespace uranium::core;
+using namespace uranium::memory;
+
+size_t IAllocator::bytes() const noexcept {
+  size_t total = 0;
+  for (size_t tag = 0; tag < TAG_COUNT; ++tag) {
+    total += bytesOf(static_cast<Tag>(tag));
+  }
+  return total;
+}
+
+void IAllocator::logUsage(std::string_view name) const {
+  std::string usage;
+  for (size_t i = 0; i < TAG_COUNT; ++i) {
+    Tag tag = static_cast<Tag>(i);
+    if (size_t used = bytesOf(tag)) {
+      usage += std::format("{}{} {} B", usage.empty() ? "" : ", ",
+                           Logger::toString(tag), used);
+    }
+  }
+  Logger::UR_INFO(LogCategory::MEMORY, "{}: {} B in use ({})", name, bytes(),
+                  usage.empty() ? "empty" : usage);
+}
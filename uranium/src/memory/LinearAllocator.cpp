@@ -0,0 +1,140 @@
+#include "uranium/memory/LinearAllocator.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <new>
+
+#include "uranium/core/Utils.hpp"
+#include "uranium/memory/MemoryTracker.hpp"
+
+using namespace uranium::core;
+using namespace uranium::memory;
+
+static std::byte* newBuffer(size_t size) {
+  MemoryScope scope(Tag::MEMORY);
+  return static_cast<std::byte*>(
+      ::operator new(size, std::align_val_t{UR_CACHE_LINE}));
+}
+
+static void deleteBuffer(std::byte* buffer) noexcept {
+  ::operator delete(buffer, std::align_val_t{UR_CACHE_LINE});
+}
+
+LinearAllocator::LinearAllocator(size_t capacity)
+    : buffer(newBuffer(capacity)),
+      buffer_size(capacity),
+      offset(0),
+      tagged(),
+      peak(0),
+      grow(),
+      overflow(nullptr) {}
+
+LinearAllocator::~LinearAllocator() noexcept {
+  release();
+  deleteBuffer(buffer);
+}
+
+void* LinearAllocator::allocate(size_t size, size_t alignment, Tag tag) {
+  // Reserve enough room to align the pointer inside the reservation
+  size_t need = size + alignment - 1;
+  size_t start = offset.fetch_add(need, std::memory_order_relaxed);
+  if (start + need > buffer_size) {
+    return spill(size, alignment, tag);
+  }
+
+  tagged[static_cast<size_t>(tag)].fetch_add(size, std::memory_order_relaxed);
+  MemoryTracker::allocated(tag, size);
+  uintptr_t address = reinterpret_cast<uintptr_t>(buffer) + start;
+  return reinterpret_cast<void*>((address + alignment - 1) & ~(alignment - 1));
+}
+
+size_t LinearAllocator::bytesOf(Tag tag) const noexcept {
+  return tagged[static_cast<size_t>(tag)].load(std::memory_order_relaxed);
+}
+
+LinearAllocator::Marker LinearAllocator::mark() const noexcept {
+  Marker marker{offset.load(std::memory_order_relaxed), {}};
+  for (size_t tag = 0; tag < TAG_COUNT; ++tag) {
+    marker.tagged[tag] = tagged[tag].load(std::memory_order_relaxed);
+  }
+  return marker;
+}
+
+void LinearAllocator::rewind(const Marker& marker) noexcept {
+  // A marker past the current position is stale or from another allocator,
+  // rewinding to it would corrupt the tag counters
+  size_t current = offset.load(std::memory_order_relaxed);
+  bool stale = marker.offset > current;
+  for (size_t tag = 0; tag < TAG_COUNT; ++tag) {
+    stale |= marker.tagged[tag] > tagged[tag].load(std::memory_order_relaxed);
+  }
+  UR_ASSERT(stale);
+  if (stale) {
+    return;
+  }
+
+  peak = std::max(peak, current);
+  offset.store(marker.offset, std::memory_order_relaxed);
+  for (size_t tag = 0; tag < TAG_COUNT; ++tag) {
+    size_t bytes = tagged[tag].exchange(marker.tagged[tag],
+                                        std::memory_order_relaxed);
+    MemoryTracker::freed(static_cast<Tag>(tag), bytes - marker.tagged[tag]);
+  }
+}
+
+void LinearAllocator::reset() noexcept {
+  release();
+  for (size_t tag = 0; tag < TAG_COUNT; ++tag) {
+    size_t bytes = tagged[tag].exchange(0, std::memory_order_relaxed);
+    MemoryTracker::freed(static_cast<Tag>(tag), bytes);
+  }
+
+  // The buffer was outgrown, replace it with one that fits the whole use
+  peak = std::max(peak, offset.load(std::memory_order_relaxed));
+  if (peak > buffer_size) {
+    deleteBuffer(buffer);
+    buffer_size = std::bit_ceil(peak);
+    buffer = newBuffer(buffer_size);
+    Logger::UR_INFO(LogCategory::MEMORY, "Linear allocator grown to {} B",
+                    buffer_size);
+  }
+  offset.store(0, std::memory_order_relaxed);
+  peak = 0;
+}
+
+size_t LinearAllocator::used() const noexcept {
+  return std::min(offset.load(std::memory_order_relaxed), buffer_size);
+}
+
+size_t LinearAllocator::capacity() const noexcept { return buffer_size; }
+
+void* LinearAllocator::spill(size_t size, size_t alignment, Tag tag) {
+  Logger::UR_WARN(LogCategory::MEMORY,
+                  "Linear allocator of {} B exhausted, {} B taken from the "
+                  "heap until the next reset",
+                  buffer_size, size);
+
+  // The header is followed by the allocation, aligned past it
+  void* memory;
+  {
+    MemoryScope scope(Tag::MEMORY);
+    memory = ::operator new(sizeof(Overflow) + size + alignment - 1);
+  }
+  uintptr_t address = reinterpret_cast<uintptr_t>(memory) + sizeof(Overflow);
+  {
+    std::lock_guard<std::mutex> lock(grow);
+    overflow = ::new (memory) Overflow{overflow};
+  }
+
+  tagged[static_cast<size_t>(tag)].fetch_add(size, std::memory_order_relaxed);
+  MemoryTracker::allocated(tag, size);
+  return reinterpret_cast<void*>((address + alignment - 1) & ~(alignment - 1));
+}
+
+void LinearAllocator::release() noexcept {
+  while (overflow) {
+    Overflow* next = overflow->next;
+    ::operator delete(overflow);
+    overflow = next;
+  }
+}
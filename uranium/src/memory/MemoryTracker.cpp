@@ -0,0 +1,389 @@
+#include "uranium/memory/MemoryTracker.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+using namespace uranium::core;
+using namespace uranium::memory;
+
+/**
+ * @struct Counters
+ * @brief Usage per tag, bytes from the heap and from the engine allocators.
+ */
+struct Counters {
+  std::array<std::atomic<int64_t>, TAG_COUNT> heap;
+  std::array<std::atomic<int64_t>, TAG_COUNT> arena;
+  std::array<std::atomic<uint64_t>, TAG_COUNT> allocations;
+};
+
+/**
+ * @struct ThreadCounters
+ * @brief Counters written by their thread only. Linked in the registry
+ *        on the first allocation of the thread, and folded into the
+ *        retired totals when it exits.
+ */
+struct ThreadCounters : Counters {
+  ThreadCounters* next = nullptr;
+  bool registered = false;
+  bool retired = false;
+};
+
+/**
+ * @struct Retire
+ * @brief Folds the counters of the thread when it exits.
+ */
+struct Retire {
+  ~Retire() noexcept;
+};
+
+/**
+ * @struct Sampling
+ * @brief What update() keeps between calls.
+ */
+struct Sampling {
+  std::array<int64_t, TAG_COUNT> peak{};
+  std::array<double, TAG_COUNT> rate{};
+  std::array<uint64_t, TAG_COUNT> allocations{};
+  std::array<size_t, TAG_COUNT> budget{};
+  std::array<bool, TAG_COUNT> over{};
+
+  MemoryTracker::Clock::duration dump_interval{};
+  MemoryTracker::Clock::time_point last_update{};
+  MemoryTracker::Clock::time_point last_dump{};
+};
+
+// Constant-initialized, the heap hooks may run before any constructor
+static constinit std::mutex registry;
+static constinit ThreadCounters* threads = nullptr;
+static constinit Counters retired{};
+
+static constinit std::mutex sampling_mutex;
+static constinit Sampling sampling{};
+
+static constinit thread_local ThreadCounters thread_counters{};
+static thread_local Retire thread_retire;
+static constinit thread_local Tag thread_tag = Tag::NONE;
+
+// Logger::toString() leaves NONE unnamed
+static std::string_view nameOf(Tag tag) noexcept {
+  return tag == Tag::NONE ? "[NONE]" : Logger::toString(tag);
+}
+
+// Written by its thread only, a plain load and store instead of an RMW
+template <typename T>
+static void bump(std::atomic<T>& counter, T delta) noexcept {
+  counter.store(counter.load(std::memory_order_relaxed) + delta,
+                std::memory_order_relaxed);
+}
+
+static void enroll(ThreadCounters& self) noexcept {
+  {
+    std::lock_guard<std::mutex> lock(registry);
+    self.next = threads;
+    threads = &self;
+    self.registered = true;
+  }
+  // Constructing it schedules its destructor at thread exit
+  (void)&thread_retire;
+}
+
+Retire::~Retire() noexcept {
+  ThreadCounters& self = thread_counters;
+  std::lock_guard<std::mutex> lock(registry);
+  for (size_t tag = 0; tag < TAG_COUNT; ++tag) {
+    retired.heap[tag].fetch_add(self.heap[tag].load(std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+    retired.arena[tag].fetch_add(
+        self.arena[tag].load(std::memory_order_relaxed),
+        std::memory_order_relaxed);
+    retired.allocations[tag].fetch_add(
+        self.allocations[tag].load(std::memory_order_relaxed),
+        std::memory_order_relaxed);
+  }
+  for (ThreadCounters** link = &threads; *link; link = &(*link)->next) {
+    if (*link == &self) {
+      *link = self.next;
+      break;
+    }
+  }
+  self.retired = true;
+}
+
+static void count(bool heap, Tag tag, int64_t delta) noexcept {
+  ThreadCounters& self = thread_counters;
+  size_t index = static_cast<size_t>(tag);
+
+  // Allocations made while the thread is exiting go to the shared totals
+  if (self.retired) {
+    (heap ? retired.heap : retired.arena)[index].fetch_add(
+        delta, std::memory_order_relaxed);
+    if (delta > 0) {
+      retired.allocations[index].fetch_add(1, std::memory_order_relaxed);
+    }
+    return;
+  }
+
+  if (!self.registered) {
+    enroll(self);
+  }
+  bump((heap ? self.heap : self.arena)[index], delta);
+  if (delta > 0) {
+    bump<uint64_t>(self.allocations[index], 1);
+  }
+}
+
+static void sum(std::array<TagStats, TAG_COUNT>& stats) noexcept {
+  auto add = [&](const Counters& counters) {
+    for (size_t tag = 0; tag < TAG_COUNT; ++tag) {
+      stats[tag].heap += counters.heap[tag].load(std::memory_order_relaxed);
+      stats[tag].arena += counters.arena[tag].load(std::memory_order_relaxed);
+      stats[tag].allocations +=
+          counters.allocations[tag].load(std::memory_order_relaxed);
+    }
+  };
+
+  std::lock_guard<std::mutex> lock(registry);
+  add(retired);
+  for (ThreadCounters* thread = threads; thread; thread = thread->next) {
+    add(*thread);
+  }
+}
+
+// Totals of every tag, with the peaks and rates of the last update()
+static void snapshot(std::array<TagStats, TAG_COUNT>& stats) noexcept {
+  sum(stats);
+
+  std::lock_guard<std::mutex> lock(sampling_mutex);
+  for (size_t tag = 0; tag < TAG_COUNT; ++tag) {
+    stats[tag].peak = std::max(sampling.peak[tag], stats[tag].live());
+    stats[tag].rate = sampling.rate[tag];
+    stats[tag].budget = sampling.budget[tag];
+  }
+}
+
+void MemoryTracker::allocated(Tag tag, size_t bytes) noexcept {
+  count(false, tag, static_cast<int64_t>(bytes));
+}
+
+void MemoryTracker::freed(Tag tag, size_t bytes) noexcept {
+  count(false, tag, -static_cast<int64_t>(bytes));
+}
+
+TagStats MemoryTracker::stats(Tag tag) noexcept {
+  std::array<TagStats, TAG_COUNT> stats{};
+  snapshot(stats);
+  return stats[static_cast<size_t>(tag)];
+}
+
+void MemoryTracker::setBudget(Tag tag, size_t bytes) noexcept {
+  std::lock_guard<std::mutex> lock(sampling_mutex);
+  sampling.budget[static_cast<size_t>(tag)] = bytes;
+}
+
+void MemoryTracker::setDumpInterval(Clock::duration interval) noexcept {
+  std::lock_guard<std::mutex> lock(sampling_mutex);
+  sampling.dump_interval = interval;
+}
+
+void MemoryTracker::update() {
+  std::array<TagStats, TAG_COUNT> stats{};
+  sum(stats);
+
+  Clock::time_point now = Clock::now();
+  bool due = false;
+  {
+    std::lock_guard<std::mutex> lock(sampling_mutex);
+    double elapsed =
+        sampling.last_update == Clock::time_point{}
+            ? 0.0
+            : std::chrono::duration<double>(now - sampling.last_update)
+                  .count();
+    sampling.last_update = now;
+
+    for (size_t tag = 0; tag < TAG_COUNT; ++tag) {
+      int64_t live = stats[tag].live();
+      sampling.peak[tag] = std::max(sampling.peak[tag], live);
+      sampling.rate[tag] =
+          elapsed > 0.0
+              ? (stats[tag].allocations - sampling.allocations[tag]) / elapsed
+              : 0.0;
+      sampling.allocations[tag] = stats[tag].allocations;
+
+      // Warn when crossing the budget, not on every frame spent over it
+      size_t budget = sampling.budget[tag];
+      bool over = budget != 0 && live > static_cast<int64_t>(budget);
+      if (over && !sampling.over[tag]) {
+        Logger::UR_WARN(LogCategory::MEMORY,
+                        "{} is over its budget: {} B of {} B",
+                        nameOf(static_cast<Tag>(tag)), live,
+                        budget);
+      }
+      sampling.over[tag] = over;
+    }
+
+    if (sampling.dump_interval != Clock::duration::zero() &&
+        now - sampling.last_dump >= sampling.dump_interval) {
+      sampling.last_dump = now;
+      due = true;
+    }
+  }
+
+  if (due) {
+    dump();
+  }
+}
+
+void MemoryTracker::dump() {
+  std::array<TagStats, TAG_COUNT> stats{};
+  snapshot(stats);
+
+  int64_t total = 0;
+  for (const TagStats& tag_stats : stats) {
+    total += tag_stats.live();
+  }
+  Logger::UR_INFO(LogCategory::MEMORY, "Memory in use: {} B{}", total,
+                  tracksHeap() ? "" : " (heap not tracked)");
+
+  for (size_t tag = 0; tag < TAG_COUNT; ++tag) {
+    const TagStats& tag_stats = stats[tag];
+    if (tag_stats.live() == 0 && tag_stats.allocations == 0) {
+      continue;
+    }
+    Logger::UR_INFO(
+        LogCategory::MEMORY,
+        "{}: {} B ({} B heap, {} B arena), peak {} B, {:.0f} allocs/s{}",
+        nameOf(static_cast<Tag>(tag)), tag_stats.live(),
+        tag_stats.heap, tag_stats.arena, tag_stats.peak, tag_stats.rate,
+        tag_stats.budget ? std::format(", budget {} B", tag_stats.budget)
+                         : "");
+  }
+}
+
+MemoryScope::MemoryScope(Tag tag) noexcept : previous(thread_tag) {
+  thread_tag = tag;
+}
+
+MemoryScope::~MemoryScope() noexcept { thread_tag = previous; }
+
+Tag MemoryScope::current() noexcept { return thread_tag; }
+
+#if defined(UR_TRACK_MEMORY)
+
+/**
+ * @struct Header
+ * @brief Placed right before every tracked heap block, to account its
+ *        release to the tag it was allocated for.
+ */
+struct Header {
+  uint64_t size;
+  uint32_t tag;
+  uint32_t offset;  // From the start of the malloc() block to the user one
+};
+
+static_assert(sizeof(Header) == 16, "Header must keep blocks aligned.");
+
+static void* trackedNew(size_t size, size_t alignment) noexcept {
+  // Over-aligned blocks need room to move the pointer forward
+  size_t slack = alignment > alignof(std::max_align_t) ? alignment : 0;
+
+  void* raw = std::malloc(sizeof(Header) + slack + size);
+  while (!raw) {
+    std::new_handler handler = std::get_new_handler();
+    if (!handler) {
+      return nullptr;
+    }
+    handler();
+    raw = std::malloc(sizeof(Header) + slack + size);
+  }
+
+  uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+  uintptr_t user = (start + sizeof(Header) + alignment - 1) & ~(alignment - 1);
+  Tag tag = thread_tag;
+  ::new (reinterpret_cast<Header*>(user) - 1)
+      Header{size, static_cast<uint32_t>(tag),
+             static_cast<uint32_t>(user - start)};
+
+  count(true, tag, static_cast<int64_t>(size));
+  return reinterpret_cast<void*>(user);
+}
+
+static void trackedDelete(void* ptr) noexcept {
+  if (!ptr) {
+    return;
+  }
+  Header* header = static_cast<Header*>(ptr) - 1;
+  count(true, static_cast<Tag>(header->tag),
+        -static_cast<int64_t>(header->size));
+  std::free(static_cast<std::byte*>(ptr) - header->offset);
+}
+
+void* operator new(size_t size) {
+  if (void* ptr = trackedNew(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+  if (void* ptr = trackedNew(size, static_cast<size_t>(alignment))) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return trackedNew(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(size_t size, std::align_val_t alignment,
+                   const std::nothrow_t&) noexcept {
+  return trackedNew(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { trackedDelete(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { trackedDelete(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  trackedDelete(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+  trackedDelete(ptr);
+}
+
+// The array forms forward to the ones above by default, replaced as well in
+// case a runtime (e.g. a sanitizer) provides its own
+
+void* operator new[](size_t size) { return ::operator new(size); }
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+  return ::operator new(size, alignment);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return trackedNew(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+  return trackedNew(size, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* ptr) noexcept { trackedDelete(ptr); }
+
+void operator delete[](void* ptr, size_t) noexcept { trackedDelete(ptr); }
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  trackedDelete(ptr);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept {
+  trackedDelete(ptr);
+}
+
+#endif
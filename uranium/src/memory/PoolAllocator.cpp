@@ -0,0 +1,92 @@
+#include "uranium/memory/PoolAllocator.hpp"
+
+#include <algorithm>
+#include <new>
+
+#include "uranium/memory/MemoryTracker.hpp"
+
+using namespace uranium::core;
+using namespace uranium::memory;
+
+static size_t alignUp(size_t value, size_t alignment) noexcept {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+PoolAllocator::PoolAllocator(size_t block_size, size_t alignment,
+                             size_t blocks_per_slab)
+    : block_size(alignUp(std::max(block_size, sizeof(FreeBlock)),
+                         std::max(alignment, alignof(FreeBlock)))),
+      alignment(std::max(alignment, alignof(FreeBlock))),
+      blocks_per_slab(std::max<size_t>(blocks_per_slab, 1)),
+      slabs(nullptr),
+      free_list(nullptr),
+      blocks(0),
+      available(0),
+      tagged() {
+  addSlab();
+}
+
+PoolAllocator::~PoolAllocator() noexcept {
+  while (slabs) {
+    Slab* next = slabs->next;
+    ::operator delete(slabs, std::align_val_t{alignment});
+    slabs = next;
+  }
+}
+
+void* PoolAllocator::allocate(size_t size, size_t alignment, Tag tag) {
+  if (size > block_size || alignment > this->alignment) {
+    Logger::UR_ERROR(LogCategory::MEMORY,
+                     "Pool of {} B blocks aligned to {} cannot serve {} B "
+                     "aligned to {}",
+                     block_size, this->alignment, size, alignment);
+    return nullptr;
+  }
+
+  if (!free_list) {
+    addSlab();
+  }
+  FreeBlock* block = free_list;
+  free_list = block->next;
+  --available;
+
+  tagged[static_cast<size_t>(tag)] += block_size;
+  MemoryTracker::allocated(tag, block_size);
+  return block;
+}
+
+void PoolAllocator::deallocate(void* ptr, size_t size, Tag tag) noexcept {
+  if (!ptr) {
+    return;
+  }
+  free_list = ::new (ptr) FreeBlock{free_list};
+  ++available;
+  tagged[static_cast<size_t>(tag)] -= block_size;
+  MemoryTracker::freed(tag, block_size);
+}
+
+size_t PoolAllocator::bytesOf(Tag tag) const noexcept {
+  return tagged[static_cast<size_t>(tag)];
+}
+
+size_t PoolAllocator::blockSize() const noexcept { return block_size; }
+
+size_t PoolAllocator::blockCount() const noexcept { return blocks; }
+
+size_t PoolAllocator::freeCount() const noexcept { return available; }
+
+void PoolAllocator::addSlab() {
+  MemoryScope scope(Tag::MEMORY);
+  size_t header = alignUp(sizeof(Slab), alignment);
+  void* memory = ::operator new(header + block_size * blocks_per_slab,
+                                std::align_val_t{alignment});
+  slabs = ::new (memory) Slab{slabs};
+
+  // Link the blocks in address order, so a fresh slab is used front to back
+  std::byte* first = static_cast<std::byte*>(memory) + header;
+  for (size_t i = blocks_per_slab; i-- > 0;) {
+    free_list = ::new (first + i * block_size) FreeBlock{free_list};
+  }
+  blocks += blocks_per_slab;
+  available += blocks_per_slab;
+}
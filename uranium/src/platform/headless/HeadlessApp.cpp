@@ -0,0 +1,13 @@
+#include "uranium/platform/headless/HeadlessApp.hpp"
+
+using namespace uranium::core;
+using namespace uranium::platform::headless;
+
+HeadlessApp::HeadlessApp(const IDisplay::Properties& properties) noexcept
+    : IApp(), display(properties) {}
+
+const IMonitor* HeadlessApp::primaryMonitor() { return nullptr; }
+
+bool HeadlessApp::pollEvents() { return display.pollEvents(); }
+
+const IMonitor* HeadlessApp::selectMonitor(uint32_t) { return nullptr; }
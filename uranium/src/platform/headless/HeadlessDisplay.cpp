@@ -0,0 +1,116 @@
+#include "uranium/platform/headless/HeadlessDisplay.hpp"
+
+#include "uranium/core/Logger.hpp"
+
+using namespace uranium::core;
+using namespace uranium::platform::headless;
+
+HeadlessDisplay::HeadlessDisplay(
+    const IDisplay::Properties& properties) noexcept
+    : IDisplay(properties) {
+  initialized = true;
+  Logger::UR_INFO(LogCategory::ENGINE, "Headless display {}x{} created.",
+                  properties.width, properties.height);
+}
+
+void HeadlessDisplay::close() { initialized = false; }
+
+bool HeadlessDisplay::pollEvents() { return initialized; }
+
+void HeadlessDisplay::reload(const Properties& properties) {
+  this->properties = properties;
+}
+
+void HeadlessDisplay::setTitle(const std::string& title) {
+  properties.title = title;
+}
+
+void HeadlessDisplay::setIcon(const std::string& icon_path) {
+  properties.icon_path = icon_path;
+}
+
+void HeadlessDisplay::resize(uint32_t width, uint32_t height) {
+  if (width == 0 || height == 0) {
+    Logger::UR_ERROR(LogCategory::ENGINE,
+                     "Invalid dimensions for resizing: {}x{}.", width, height);
+    return;
+  }
+  properties.width = width;
+  properties.height = height;
+}
+
+void HeadlessDisplay::setMode(IMonitor*, Mode mode) {
+  properties.mode = mode;
+}
+
+void HeadlessDisplay::setResolution(Resolution resolution) {
+  switch (resolution) {
+    case Resolution::R_800x600:
+      properties.width = 800;
+      properties.height = 600;
+      break;
+    case Resolution::R_1024x768:
+      properties.width = 1024;
+      properties.height = 768;
+      break;
+    case Resolution::R_1280x720:
+      properties.width = 1280;
+      properties.height = 720;
+      break;
+    case Resolution::R_1920x1080:
+      properties.width = 1920;
+      properties.height = 1080;
+      break;
+    case Resolution::R_2560x1440:
+      properties.width = 2560;
+      properties.height = 1440;
+      break;
+    case Resolution::R_3840x2160:
+      properties.width = 3840;
+      properties.height = 2160;
+      break;
+    default:
+      Logger::UR_ERROR(LogCategory::ENGINE, "Invalid resolution specified: {}.",
+                       "R_CUSTOM");
+      return;
+  }
+  properties.resolution = resolution;
+}
+
+void HeadlessDisplay::setResolution(uint32_t width, uint32_t height) {
+  if (width == 0 || height == 0) {
+    Logger::UR_ERROR(LogCategory::ENGINE,
+                     "Invalid resolution dimensions: {}x{}.", width, height);
+    return;
+  }
+  properties.width = width;
+  properties.height = height;
+  properties.resolution = Resolution::R_CUSTOM;
+}
+
+void HeadlessDisplay::setOpacity(uint8_t opacity) {
+  properties.opacity = opacity;
+}
+
+void HeadlessDisplay::setVisible(bool visible) {
+  properties.visible = visible;
+}
+
+void HeadlessDisplay::setPosition(int32_t xpos, int32_t ypos) {
+  properties.xposition = xpos;
+  properties.yposition = ypos;
+}
+
+void HeadlessDisplay::center(const IMonitor&) {}
+
+void HeadlessDisplay::setAntialiasLevel(uint32_t antialias_level) {
+  properties.antialiasingLevel = antialias_level;
+}
+
+void HeadlessDisplay::enableVsync(bool enable) { properties.vsync = enable; }
+
+void HeadlessDisplay::focus() {}
+
+void HeadlessDisplay::restore() {}
+
+void HeadlessDisplay::requestAttention() {}
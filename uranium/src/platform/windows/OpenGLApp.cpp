@@ -10,7 +10,21 @@
 using namespace uranium::core;
 using namespace uranium::platform::windows;
 
-OpenGLApp::OpenGLApp() noexcept : IApp() {}
+OpenGLApp::OpenGLApp(const IDisplay::Properties& properties) noexcept
+    : IApp(), display() {
+  // The monitor is looked up before the display initializes GLFW
+  if (!glfwInit()) {
+    Logger::UR_FATAL(LogCategory::ENGINE, "Failed to initialize GLFW.");
+    std::terminate();
+  }
+  display = std::make_unique<OpenGLDisplay>(properties, *primaryMonitor());
+}
+
+OpenGLApp::~OpenGLApp() noexcept {
+  if (display && display->hasInitialized()) {
+    display->close();
+  }
+}
 
 const IMonitor* OpenGLApp::primaryMonitor() {
   // If no monitor is available, create a new reference
@@ -39,4 +53,6 @@ const IMonitor* OpenGLApp::selectMonitor(uint32_t selection) {
   monitor = std::unique_ptr<IMonitor>(new IMonitor(monitor_devices[selection]));
 
   return monitor.get();
-}
\ No newline at end of file
+}
+
+bool OpenGLApp::pollEvents() { return display->pollEvents(); }
@@ -4,6 +4,7 @@
 
 #include "uranium/core/IMonitor.hpp"
 #include "uranium/core/Logger.hpp"
+#include "uranium/core/Profiler.hpp"
 
 using namespace uranium::core;
 using namespace uranium::platform::windows;
@@ -11,6 +12,7 @@ using namespace uranium::platform::windows;
 OpenGLDisplay::OpenGLDisplay(const core::IDisplay::Properties& properties,
                              const core::IMonitor& smonitor) noexcept
     : core::IDisplay(properties, smonitor) {
+  UR_PROFILE_SCOPE("OpenGLDisplay::OpenGLDisplay");
   if (!glfwInit()) {
     Logger::UR_FATAL(LogCategory::ENGINE,
                      "Failed to initialize GLFW for OpenGL.");
@@ -44,19 +46,32 @@ OpenGLDisplay::OpenGLDisplay(const core::IDisplay::Properties& properties,
   if (properties.vsync) {
     glfwSwapInterval(1);
   }
+  initialized = true;
 }
 
 void OpenGLDisplay::close() {
+  UR_PROFILE_SCOPE("OpenGLDisplay::close");
   if (!glfwWindow) {
     Logger::UR_ERROR(LogCategory::ENGINE,
                      "Cannot close OpenGL without a valid GLFW window.");
     return;
   }
   glfwDestroyWindow(glfwWindow);
+  glfwWindow = nullptr;
+  initialized = false;
   glfwTerminate();
 }
 
+bool OpenGLDisplay::pollEvents() {
+  if (!glfwWindow) {
+    return false;
+  }
+  glfwPollEvents();
+  return !glfwWindowShouldClose(glfwWindow);
+}
+
 void OpenGLDisplay::reload(const Properties& properties) {
+  UR_PROFILE_SCOPE("OpenGLDisplay::reload");
   if (!glfwWindow) {
     Logger::UR_ERROR(LogCategory::ENGINE,
                      "Cannot reload without a valid GLFW window.");
@@ -77,6 +92,7 @@ void OpenGLDisplay::setTitle(const std::string& title) {
 void OpenGLDisplay::setIcon(const std::string& icon_path) {}
 
 void OpenGLDisplay::resize(uint32_t width, uint32_t height) {
+  UR_PROFILE_SCOPE("OpenGLDisplay::resize");
   if (!glfwWindow) {
     Logger::UR_ERROR(LogCategory::ENGINE,
                      "Cannot resize without a valid GLFW window.");
@@ -93,6 +109,7 @@ void OpenGLDisplay::resize(uint32_t width, uint32_t height) {
 }
 
 void OpenGLDisplay::setMode(IMonitor* monitor, Mode mode) {
+  UR_PROFILE_SCOPE("OpenGLDisplay::setMode");
   if (!glfwWindow) {
     Logger::UR_ERROR(LogCategory::ENGINE,
                      "Cannot set mode without a valid GLFW window.");
@@ -153,6 +170,7 @@ void OpenGLDisplay::setMode(IMonitor* monitor, Mode mode) {
 }
 
 void OpenGLDisplay::setResolution(Resolution resolution) {
+  UR_PROFILE_SCOPE("OpenGLDisplay::setResolution");
   if (!glfwWindow) {
     Logger::UR_ERROR(LogCategory::ENGINE,
                      "Cannot set resolution without a valid GLFW window.");
@@ -195,6 +213,7 @@ void OpenGLDisplay::setResolution(Resolution resolution) {
 }
 
 void OpenGLDisplay::setResolution(uint32_t width, uint32_t height) {
+  UR_PROFILE_SCOPE("OpenGLDisplay::setResolution");
   if (!glfwWindow) {
     Logger::UR_ERROR(LogCategory::ENGINE,
                      "Cannot set resolution without a valid GLFW window.");
@@ -256,6 +275,7 @@ void OpenGLDisplay::setPosition(int32_t xpos, int32_t ypos) {
 }
 
 void OpenGLDisplay::center(const IMonitor& monitor) {
+  UR_PROFILE_SCOPE("OpenGLDisplay::center");
   if (!glfwWindow) {
     Logger::UR_ERROR(LogCategory::ENGINE,
                      "Cannot center display without a valid GLFW window.");
@@ -0,0 +1,313 @@
+/*******************************************************************
+ * @file   main.cpp
+ * @brief  Renders a binary .urlog file as text.
+ *
+ *         usage: urlog <file.urlog> [output.txt]
+ *                urlog --flight <base> [output.txt]
+ *
+ * @author Alfredo
+ * @date   October 2026
+ *******************************************************************/
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <print>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "uranium/core/BinaryLog.hpp"
+#include "uranium/core/FlightRecorder.hpp"
+#include "uranium/core/Logger.hpp"
+
+using namespace uranium::core;
+
+using Value = std::variant<bool, char, int32_t, int64_t, uint32_t, uint64_t,
+                           double, std::string_view, const void*>;
+
+/**
+ * @struct Site
+ * @brief A call site read from the file.
+ */
+struct Site {
+  LogLevel level;
+  LogCategory category;
+  std::string_view format;
+  std::string_view tags;
+};
+
+/**
+ * @class Reader
+ * @brief Bounds-checked cursor over the bytes of the file.
+ */
+class Reader final {
+public:
+  explicit Reader(std::string_view data) noexcept : data(data), cursor(0) {}
+
+  template <typename T>
+  bool read(T& value) noexcept {
+    if (cursor + sizeof(T) > data.size()) {
+      return false;
+    }
+    std::memcpy(&value, data.data() + cursor, sizeof(T));
+    cursor += sizeof(T);
+    return true;
+  }
+
+  bool read(std::string_view& text, size_t size) noexcept {
+    if (cursor + size > data.size()) {
+      return false;
+    }
+    text = data.substr(cursor, size);
+    cursor += size;
+    return true;
+  }
+
+  bool done() const noexcept { return cursor >= data.size(); }
+
+private:
+  std::string_view data;
+  size_t cursor;
+};
+
+static bool decodeValue(Reader& reader, char tag, Value& value) {
+  switch (tag) {
+    case urlog::BOOL: {
+      uint8_t v;
+      return reader.read(v) && ((value = v != 0), true);
+    }
+    case urlog::CHAR: {
+      char v;
+      return reader.read(v) && ((value = v), true);
+    }
+    case urlog::INT32: {
+      int32_t v;
+      return reader.read(v) && ((value = v), true);
+    }
+    case urlog::INT64: {
+      int64_t v;
+      return reader.read(v) && ((value = v), true);
+    }
+    case urlog::UINT32: {
+      uint32_t v;
+      return reader.read(v) && ((value = v), true);
+    }
+    case urlog::UINT64: {
+      uint64_t v;
+      return reader.read(v) && ((value = v), true);
+    }
+    case urlog::DOUBLE: {
+      double v;
+      return reader.read(v) && ((value = v), true);
+    }
+    case urlog::STRING: {
+      uint16_t size;
+      std::string_view v;
+      return reader.read(size) && reader.read(v, size) && ((value = v), true);
+    }
+    case urlog::POINTER: {
+      uint64_t v;
+      return reader.read(v) &&
+             ((value = reinterpret_cast<const void*>(v)), true);
+    }
+    default:
+      return false;
+  }
+}
+
+static std::string formatValue(std::string_view spec, const Value& value) {
+  std::string field = std::format("{{{}}}", spec);
+  try {
+    return std::visit(
+        [&](const auto& v) {
+          return std::vformat(field, std::make_format_args(v));
+        },
+        value);
+  } catch (const std::format_error&) {
+    return "{?}";
+  }
+}
+
+static std::string render(std::string_view format,
+                          const std::vector<Value>& values) {
+  // Walk the replacement fields one by one, each with its own arguments
+  std::string out;
+  size_t next = 0;
+  for (size_t i = 0; i < format.size(); ++i) {
+    char c = format[i];
+    if ((c == '{' || c == '}') && i + 1 < format.size() &&
+        format[i + 1] == c) {
+      out += c;
+      ++i;
+      continue;
+    }
+    if (c != '{') {
+      out += c;
+      continue;
+    }
+
+    size_t end = format.find('}', i);
+    if (end == std::string_view::npos) {
+      out += format.substr(i);
+      break;
+    }
+
+    // Split an explicit index from the format spec
+    std::string_view field = format.substr(i + 1, end - i - 1);
+    size_t colon = field.find(':');
+    std::string_view index = field.substr(0, colon);
+    std::string_view spec =
+        colon == std::string_view::npos ? "" : field.substr(colon);
+
+    // The format comes from the file, an index may not even be a number
+    size_t argument = next++;
+    if (!index.empty()) {
+      auto [last, error] =
+          std::from_chars(index.data(), index.data() + index.size(), argument);
+      if (error != std::errc() || last != index.data() + index.size()) {
+        argument = values.size();
+      }
+    }
+    out += argument < values.size() ? formatValue(spec, values[argument])
+                                    : "{?}";
+    i = end;
+  }
+  return out;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2 || (std::string_view(argv[1]) == "--flight" && argc < 3)) {
+    std::println("usage: urlog <file.urlog> [output.txt]");
+    std::println("       urlog --flight <base> [output.txt]");
+    return 1;
+  }
+
+  // Flight recorder files are already text, only their order matters
+  if (std::string_view(argv[1]) == "--flight") {
+    std::FILE* output = argc > 3 ? std::fopen(argv[3], "w") : stdout;
+    if (!output) {
+      std::println("Cannot open {}", argv[3]);
+      return 1;
+    }
+    size_t records = FlightRecorder::dump(argv[2], output);
+    if (output != stdout) {
+      std::fclose(output);
+    }
+    return records > 0 ? 0 : 1;
+  }
+
+  std::ifstream file(argv[1], std::ios::binary);
+  std::string data((std::istreambuf_iterator<char>(file)),
+                   std::istreambuf_iterator<char>());
+  std::FILE* output = argc > 2 ? std::fopen(argv[2], "w") : stdout;
+  if (!file.is_open() || !output) {
+    std::println("Cannot open {}", argc > 2 ? argv[2] : argv[1]);
+    return 1;
+  }
+
+  Reader header(data);
+  uint32_t magic = 0;
+  uint16_t version = 0, reserved = 0;
+  uint64_t base = 0;
+  if (!header.read(magic) || !header.read(version) ||
+      !header.read(reserved) || !header.read(base) ||
+      magic != urlog::MAGIC || version != urlog::VERSION) {
+    std::println("{} is not a binary log", argv[1]);
+    return 1;
+  }
+  constexpr size_t HEADER_SIZE = 16;
+
+  // Sites may follow the records that use them, collect them first
+  std::unordered_map<uint32_t, Site> sites;
+  for (int pass = 0; pass < 2; ++pass) {
+    Reader reader(std::string_view(data).substr(HEADER_SIZE));
+    while (!reader.done()) {
+      uint8_t kind;
+      uint16_t thread;
+      reader.read(kind);
+
+      if (kind == urlog::SITE) {
+        uint32_t id;
+        uint8_t level, category, count;
+        uint16_t length;
+        Site site;
+        if (!reader.read(id) || !reader.read(level) ||
+            !reader.read(category) || !reader.read(length) ||
+            !reader.read(site.format, length) || !reader.read(count) ||
+            !reader.read(site.tags, count)) {
+          break;
+        }
+        // Out of range bytes render as unknown instead of a bogus name
+        site.level = level < static_cast<uint8_t>(LogLevel::COUNT)
+                         ? static_cast<LogLevel>(level)
+                         : LogLevel::COUNT;
+        site.category = category < static_cast<uint8_t>(LogCategory::COUNT)
+                            ? static_cast<LogCategory>(category)
+                            : LogCategory::COUNT;
+        sites[id] = site;
+      } else if (kind == urlog::DROPS) {
+        uint32_t count;
+        if (!reader.read(thread) || !reader.read(count)) {
+          break;
+        }
+        if (pass == 1) {
+          std::println(output, "[T{}] {} records dropped", thread, count);
+        }
+      } else if (kind == urlog::RECORD) {
+        uint16_t length;
+        std::string_view bytes;
+        if (!reader.read(thread) || !reader.read(length) ||
+            !reader.read(bytes, length)) {
+          break;
+        }
+        if (pass == 0) {
+          continue;
+        }
+
+        Reader record(bytes);
+        uint32_t id;
+        uint64_t time;
+        if (!record.read(id) || !record.read(time)) {
+          std::println(output, "[T{}] truncated record", thread);
+          continue;
+        }
+
+        auto site = sites.find(id);
+        if (site == sites.end()) {
+          std::println(output, "[T{}] unknown site {}", thread, id);
+          continue;
+        }
+
+        // Fields past a value that cannot be decoded render as {?}
+        std::vector<Value> values(site->second.tags.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+          if (!decodeValue(record, site->second.tags[i], values[i])) {
+            values.resize(i);
+            break;
+          }
+        }
+
+        std::println(output, "[{:>14.6f}] [T{}] [{:<5}] {} {}",
+                     static_cast<int64_t>(time - base) / 1e9, thread,
+                     Logger::toString(site->second.level),
+                     Logger::toString(site->second.category),
+                     render(site->second.format, values));
+      } else {
+        // Both passes stop here, only the rendering one reports it
+        if (pass == 1) {
+          std::println(stderr, "Corrupted record, stopping");
+        }
+        break;
+      }
+    }
+  }
+
+  if (output != stdout) {
+    std::fclose(output);
+  }
+  return 0;
+}